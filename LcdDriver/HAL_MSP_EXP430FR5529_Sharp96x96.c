@@ -48,8 +48,13 @@
 #include "../driverlibHeaders.h"
 #endif
 
+#include "Sharp96x96.h"
 #include "HAL_MSP_EXP430FR5529_Sharp96x96.h"
 
+#ifdef USE_SPI_TX_QUEUE
+#include "../spibus.h"
+#endif
+
 //*****************************************************************************
 //
 //! Initializes the display driver.
@@ -57,7 +62,7 @@
 //! This function initializes the Sharp96x96 display. This function
 //! configures the GPIO pins used to control the LCD display when the basic
 //! GPIO interface is in use. On exit, the LCD has been reset and is ready to
-//! receive command and data writes.
+//! receive command and data writes, and Timer A1 is maintaining VCOM.
 //!
 //! \return None.
 //
@@ -97,8 +102,8 @@ void Sharp96x96_Init(void)
 	// Configure the SPI interface on USCI B0
     USCI_B_SPI_masterInit(USCI_B0_BASE,
                     USCI_B_SPI_CLOCKSOURCE_SMCLK,
-					8000000,
-                    1000000,
+					SPI_CLK_SRC_HZ,
+                    SPI_CLK_SRC_HZ / SPI_CLK_TICKS,
                     USCI_B_SPI_MSB_FIRST,
                     USCI_B_SPI_PHASE_DATA_CAPTURED_ONFIRST_CHANGED_ON_NEXT,
                     USCI_B_SPI_CLOCKPOLARITY_INACTIVITY_LOW);
@@ -150,8 +155,138 @@ void Sharp96x96_Init(void)
 	SPI_REG_CTL1 &= ~UCSWRST;
 	SPI_REG_IFG  &= ~UCRXIFG;
 #endif
+
+#ifdef USE_SPI_TX_QUEUE
+	// The arbiter keeps SMCLK running while it sends
+	spiBusInit();
+#endif
+
+#ifdef USE_DMA_FLUSH
+	// DMA channel 0 is triggered by the SPI transmit flag and always writes
+	// to the TX buffer; the source address and size are set per transfer
+	DMACTL0 = (DMACTL0 & 0xFF00) | SPI_DMA_TRIGGER;
+	DMACTL4 = DMARMWDIS;
+	__data16_write_addr((unsigned short)&DMA0DA, (unsigned long)&SPI_REG_TXBUF);
+	DMA0CTL = (DMADT_0|DMASRCINCR_3|DMADSTINCR_0|DMASRCBYTE|DMADSTBYTE|DMAIE);
+#endif
+
+	// Timer A1 maintains VCOM, stop it while it is configured
+	TA1CTL = TASSEL_1 | MC_0 | TACLR;
+
+#ifdef USE_EXTCOMIN
+	// The panel inverts VCOM on each rising edge of EXTCOMIN, so TA1.1
+	// toggles it every quarter period to invert on every half period, as the
+	// software VCOM does
+	PORT_EXTCOMIN_SEL |= PIN_EXTCOMIN;
+	PORT_EXTCOMIN_DIR |= PIN_EXTCOMIN;
+	TA1CCR0 = (VCOM_TIMER_CLOCK / (4 * VCOM_FREQUENCY)) - 1;
+	TA1CCR1 = 0;
+	TA1CCTL1 = OUTMOD_4;
+#else
+	// CCR0 interrupt drives Sharp96x96_VCOMTick
+	TA1CCR0 = (VCOM_TIMER_CLOCK / (2 * VCOM_FREQUENCY * VCOM_TICKS_PER_TOGGLE)) - 1;
+	TA1CCTL0 = CCIE;
+#endif
+
+	// ACLK, up mode
+	TA1CTL = TASSEL_1 | MC_1 | TACLR;
+}
+
+#ifdef USE_SPI_TX_QUEUE
+//*****************************************************************************
+//
+// LCD transactions go through the USCI_B0 arbiter in spibus.c, at normal
+// priority so DAC samples can preempt them. Each transaction is sent with the
+// chip select asserted; a transaction starts with one block of bytes and when
+// that is used up, pfnNextBlock (if any) is asked for the next one until it
+// returns a length of 0.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! Adds a transaction to the LCD queue.
+//!
+//! \param pucData is the first block of bytes to send, starting with the
+//! command byte.
+//! \param uiLength is the number of bytes in the first block.
+//! \param pfnNextBlock is called for each further block once the current one
+//! has been sent. It returns the block length, 0 to end the transaction, and
+//! stores the block address through its argument. May be 0.
+//! \param pfnDone is called from interrupt context after the chip select has
+//! been released at the end of the transaction. May be 0.
+//! \param uiSplit is the length of the lines in the blocks, or 0. With a
+//! split length the transaction can be preempted between two lines: it is
+//! closed with the trailer byte and later resumes by sending the command byte
+//! again, which the panel takes as a new multiple line write.
+//!
+//! This function may be called from thread or interrupt context.
+//!
+//! \return Returns 1 if the transaction was queued, 0 if the queue is full.
+//
+//*****************************************************************************
+uint8_t Sharp96x96_QueueStream(const uint8_t *pucData, uint16_t uiLength,
+		uint16_t (*pfnNextBlock)(const uint8_t **ppucData),
+		void (*pfnDone)(void), uint16_t uiSplit)
+{
+	SpiTransaction sTransaction;
+
+	sTransaction.data = pucData;
+	sTransaction.length = uiLength;
+	sTransaction.nextBlock = pfnNextBlock;
+	sTransaction.done = pfnDone;
+	sTransaction.split = uiSplit;
+	sTransaction.header = *pucData;
+	sTransaction.trailer = SHARP_LCD_TRAILER_BYTE;
+	sTransaction.device = SPI_DEVICE_LCD;
+
+	return spiBusQueue(SPI_PRIORITY_NORMAL, &sTransaction);
+}
+
+//*****************************************************************************
+//
+//! Adds a single byte command, followed by the trailer byte, to the LCD queue.
+//!
+//! \param ucCommand is the command byte, including the VCOM bit.
+//! \param pfnDone is called from interrupt context after the chip select has
+//! been released. May be 0.
+//!
+//! This function may be called from thread or interrupt context.
+//!
+//! \return Returns 1 if the command was queued, 0 if the queue is full.
+//
+//*****************************************************************************
+uint8_t Sharp96x96_QueueCommand(uint8_t ucCommand, void (*pfnDone)(void))
+{
+	return spiBusSend(SPI_PRIORITY_NORMAL, SPI_DEVICE_LCD, ucCommand,
+			SHARP_LCD_TRAILER_BYTE, pfnDone);
 }
 
+//*****************************************************************************
+//
+//! Returns whether no LCD transaction is queued or being sent.
+//!
+//! \return Returns 1 if nothing is queued or being sent, 0 otherwise.
+//
+//*****************************************************************************
+uint8_t Sharp96x96_IsQueueIdle(void)
+{
+	return spiBusDeviceIdle(SPI_DEVICE_LCD);
+}
+#endif //USE_SPI_TX_QUEUE
+
+#ifndef USE_EXTCOMIN
+//------------------------------------------------------------------------------
+// Timer1 A0 Interrupt Service Routine
+//------------------------------------------------------------------------------
+#pragma vector=TIMER1_A0_VECTOR
+__interrupt void TIMER1_A0_ISR (void)
+{
+	// Never waits on the SPI bus, see Sharp96x96_VCOMTick
+	Sharp96x96_VCOMTick();
+}
+#endif
+
 //*****************************************************************************
 //
 // Close the Doxygen group.
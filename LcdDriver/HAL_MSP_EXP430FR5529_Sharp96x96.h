@@ -76,6 +76,31 @@
 // Use TI's driver library for all GPIO, SPI, and Timer operations
 //#define USE_DRIVERLIB
 
+// Send all commands and data to the LCD through the USCI_B0 arbiter in
+// spibus.c, whose transaction queues are fed by the USCI_B0 interrupts, so no
+// code path waits on the SPI flags. Graphics_flushBuffer then returns as soon
+// as the flush has been queued.
+#define USE_SPI_TX_QUEUE
+
+// Move multiple byte blocks of a queued transaction (the frame data) with DMA
+// channel 0, triggered by UCB0TXIFG, instead of one interrupt per byte.
+// Requires USE_SPI_TX_QUEUE.
+#define USE_DMA_FLUSH
+
+#if defined(USE_DMA_FLUSH) && !defined(USE_SPI_TX_QUEUE)
+#error USE_DMA_FLUSH requires USE_SPI_TX_QUEUE
+#endif
+
+// Drive the panel's EXTCOMIN pin with the Timer A1 output TA1.1 on P2.0
+// instead of sending the VCOM bit over SPI. Timer A1 then runs without
+// interrupts. The panel's EXTMODE pin must be tied high and EXTCOMIN wired
+// to P2.0.
+//#define USE_EXTCOMIN
+
+// VCOM frequency in Hz, the panel's VCOM is inverted twice per period, at
+// the start of each half period, with or without USE_EXTCOMIN
+#define VCOM_FREQUENCY		1
+
 
 //*****************************************************************************
 //
@@ -118,6 +143,7 @@
 #define SPI_REG_BRL		UCB0BR0
 #define SPI_REG_BRH		UCB0BR1
 #define SPI_REG_IFG		UCB0IFG
+#define SPI_REG_IE		UCB0IE
 #define SPI_REG_STAT	UCB0STAT
 #define SPI_REG_TXBUF	UCB0TXBUF
 #define SPI_REG_RXBUF	UCB0RXBUF
@@ -127,11 +153,29 @@
  * The actual clock frequency is given in number of
  * ticks of the specified clock source.
  *
- * For our configuration, we use the same frequency
- * as SMCLK, which is 1.25MHz.
+ * For our configuration, we use SMCLK / 4, which is
+ * 1.05MHz with SMCLK at 4.19MHz (see configClocks()).
  */
 #define SPI_CLK_SRC		(UCSSEL__SMCLK)
-#define SPI_CLK_TICKS	0
+#define SPI_CLK_SRC_HZ	4194304UL
+#define SPI_CLK_TICKS	4
+
+// DMA trigger source for the USCI_B0 transmit flag (UCB0TXIFG)
+#define SPI_DMA_TRIGGER	DMA0TSEL_19
+
+/*
+ * VCOM timer
+ * Timer A1 runs from ACLK (32768Hz crystal). For software VCOM its CCR0
+ * interrupt calls Sharp96x96_VCOMTick VCOM_TICKS_PER_TOGGLE times per half
+ * period. With USE_EXTCOMIN, TA1.1 toggles EXTCOMIN twice per half period,
+ * giving the one rising edge the panel inverts on.
+ */
+#define VCOM_TIMER_CLOCK		32768
+#define VCOM_TICKS_PER_TOGGLE	2
+
+#define PORT_EXTCOMIN_SEL					P2SEL
+#define PORT_EXTCOMIN_DIR					P2DIR
+#define PIN_EXTCOMIN						BIT0
 
 // LCD Screen Dimensions
 #define LCD_VERTICAL_MAX                   96
@@ -238,6 +282,29 @@
 	} while(0)
 #endif
 
+//*****************************************************************************
+//
+// Starts a DMA transfer to the LCD
+//
+// \param pucSrc is the first byte to transfer
+// \param uiLength is the number of bytes to transfer, must be at least 1
+//
+// Channel 0 moves one byte to the SPI TX buffer on every rising edge of
+// UCB0TXIFG until uiLength bytes have been sent, then raises DMA0IFG.
+//
+// \return None
+//
+//*****************************************************************************
+#define StartLcdDma(pucSrc, uiLength)									\
+	do																	\
+	{																	\
+		DMA0CTL &= ~DMAEN;												\
+		__data16_write_addr((unsigned short)&DMA0SA,					\
+							(unsigned long)(pucSrc));					\
+		DMA0SZ   = (uiLength);											\
+		DMA0CTL |= DMAEN;												\
+	} while(0)
+
 //*****************************************************************************
 //
 // Prepare to write memory
@@ -270,4 +337,12 @@
 //
 //*****************************************************************************
 extern void Sharp96x96_Init(void);
+#ifdef USE_SPI_TX_QUEUE
+extern uint8_t Sharp96x96_QueueCommand(uint8_t ucCommand,
+		void (*pfnDone)(void));
+extern uint8_t Sharp96x96_QueueStream(const uint8_t *pucData, uint16_t uiLength,
+		uint16_t (*pfnNextBlock)(const uint8_t **ppucData),
+		void (*pfnDone)(void), uint16_t uiSplit);
+extern uint8_t Sharp96x96_IsQueueIdle(void);
+#endif
 #endif // __HAL_MSP-EXP430F5529_SHARPLCD_H__
@@ -74,23 +74,186 @@ static void Sharp96x96_InitializeDisplayBuffer(void *pvDisplayData, uint8_t ucVa
 //
 //*****************************************************************************
 
+//*****************************************************************************
+//
+// With WIRE_FORMAT_BUFFER each DisplayBuffer row is stored exactly as it is
+// sent to the panel: the bit reversed line address, the line data and the
+// trailer byte. One extra row holds the trailer that ends a multiple line
+// write, so any run of rows up to the end of the frame is a single contiguous
+// transfer. DisplayData() hides the row layout from the drawing primitives.
+//
+//*****************************************************************************
+#ifdef WIRE_FORMAT_BUFFER
+#ifdef LANDSCAPE_FLIP
+#error WIRE_FORMAT_BUFFER requires the LANDSCAPE orientation
+#endif
+#define LCD_ROW_OFFSET		1
+#define LCD_ROW_STRIDE		((LCD_HORIZONTAL_MAX>>3) + 2)
+#define LCD_BUFFER_ROWS		(LCD_VERTICAL_MAX + 1)
+#else
+#define LCD_ROW_OFFSET		0
+#define LCD_ROW_STRIDE		(LCD_HORIZONTAL_MAX>>3)
+#define LCD_BUFFER_ROWS		LCD_VERTICAL_MAX
+#endif
+
+// Bytes the panel takes for one line: address, line data and trailer
+#define LCD_LINE_PACKET		((LCD_HORIZONTAL_MAX>>3) + 2)
+
+#define DisplayData(y, xb)	\
+	(((uint8_t (*)[LCD_ROW_STRIDE])pvDisplayData)[(y)][LCD_ROW_OFFSET + (xb)])
+
 #ifdef NON_VOLATILE_MEMORY_BUFFER
 #pragma location=NON_VOLATILE_MEMORY_ADDRESS
 #endif
 
 
 #ifndef NON_VOLATILE_MEMORY_BUFFER
-uint8_t DisplayBuffer[LCD_VERTICAL_MAX][LCD_HORIZONTAL_MAX/8];
+uint8_t DisplayBuffer[LCD_BUFFER_ROWS][LCD_ROW_STRIDE];
+#ifdef DOUBLE_BUFFER
+uint8_t DisplayBuffer2[LCD_BUFFER_ROWS][LCD_ROW_STRIDE];
+#endif
 #else
+#ifdef DOUBLE_BUFFER
+#error DOUBLE_BUFFER is not supported with NON_VOLATILE_MEMORY_BUFFER
+#endif
 #ifdef __ICC430__
-__no_init uint8_t DisplayBuffer[LCD_VERTICAL_MAX +32][LCD_HORIZONTAL_MAX/8];
+__no_init uint8_t DisplayBuffer[LCD_BUFFER_ROWS +32][LCD_ROW_STRIDE];
 #else
-uint8_t DisplayBuffer[LCD_VERTICAL_MAX +32][LCD_HORIZONTAL_MAX/8];
+uint8_t DisplayBuffer[LCD_BUFFER_ROWS +32][LCD_ROW_STRIDE];
 #endif //__ICC430__
 #endif //NON_VOLATILE_MEMORY_BUFFER
 
 uint8_t VCOMbit= 0x40;
-uint8_t flagSendToggleVCOMCommand = 0;
+
+//*****************************************************************************
+//
+// VCOM state. VCOMPending is set when VCOMbit changes and cleared by the
+// next command which carries it to the panel, normally the command byte of a
+// flush. The VCOM command is only sent on its own when no other command has
+// done so in time. Without USE_SPI_TX_QUEUE, LcdBusy marks a blocking
+// transfer so the Timer A1 interrupt leaves the bus alone.
+//
+//*****************************************************************************
+static volatile uint8_t VCOMPending = 0;
+#ifndef USE_EXTCOMIN
+static uint8_t VCOMPhase = 0;
+#endif
+#ifndef USE_SPI_TX_QUEUE
+static volatile uint8_t LcdBusy = 0;
+#endif
+
+//*****************************************************************************
+//
+// Dirty line bitmap. Bit (y & 0x7) of DirtyLines[y>>3] is set whenever row y
+// of the DisplayBuffer is modified, and cleared once that row has been sent
+// to the panel. Sharp96x96_Flush only transmits rows which are marked dirty.
+//
+//*****************************************************************************
+static uint8_t DirtyLines[LCD_VERTICAL_MAX>>3];
+
+//*****************************************************************************
+//
+// With DOUBLE_BUFFER the grlib primitives draw into the back buffer, which is
+// whichever buffer g_sharp96x96LCD.displayData points to, while FrontBuffer
+// is being sent to the panel. Sharp96x96_Flush swaps the two and moves the
+// dirty rows to FlushLines, the set of rows the flush still has to send.
+// With a single buffer both are the same.
+//
+//*****************************************************************************
+#ifdef DOUBLE_BUFFER
+static uint8_t FlushLines[LCD_VERTICAL_MAX>>3];
+static uint8_t (*FrontBuffer)[LCD_ROW_STRIDE] = DisplayBuffer2;
+
+// The front buffer no longer matches the picture, after a clear screen, so the
+// next swap copies every row into the new back buffer
+static uint8_t FrontStale = 0;
+#else
+#define FlushLines			DirtyLines
+#define FrontBuffer			DisplayBuffer
+#endif
+
+//*****************************************************************************
+//
+// Number of SPI bytes (command, line addresses, data and trailers) sent by
+// the most recent call to Sharp96x96_Flush: 2 + 14 per dirty row, so 1346
+// for a full frame and 0 when nothing changed. Checked on the host by
+// tests/sharp96x96_flush_test.c.
+//
+//*****************************************************************************
+uint16_t Sharp96x96_FlushByteCount = 0;
+
+//*****************************************************************************
+//
+// Flush state. LinePacket holds one line in the panel's wire format when the
+// DisplayBuffer does not, FlushLine is the next DisplayBuffer row to examine,
+// FlushBytes counts the bytes of the frame being sent and FlushCommand holds
+// the write line command of a queued flush.
+//
+//*****************************************************************************
+#ifndef WIRE_FORMAT_BUFFER
+static uint8_t LinePacket[LCD_LINE_PACKET];
+#endif
+static int16_t FlushLine;
+static uint16_t FlushBytes;
+
+#ifdef USE_SPI_TX_QUEUE
+static uint8_t FlushCommand;
+static volatile uint8_t FlushBusy = 0;
+static volatile uint8_t FlushPending = 0;
+static void (*FlushCallback)(void) = 0;
+
+// Set up but not queued yet because the queue was full
+static volatile uint8_t FlushWaiting = 0;
+static volatile uint8_t ClearWaiting = 0;
+static volatile uint8_t ClearFirst;
+
+static void Sharp96x96_FlushDone(void);
+static void Sharp96x96_CommandDone(void);
+static void Sharp96x96_QueueWaiting(void);
+#endif
+
+#define MarkLineDirty(y)	(DirtyLines[(y)>>3] |= (0x01 << ((y) & 0x7)))
+#define IsLineQueued(y)		(FlushLines[(y)>>3] &  (0x01 << ((y) & 0x7)))
+#define ClearLineQueued(y)	(FlushLines[(y)>>3] &= ~(0x01 << ((y) & 0x7)))
+
+//*****************************************************************************
+//
+//! Marks a range of DisplayBuffer rows as modified.
+//!
+//! \param uiYMin is the first row to mark.
+//! \param uiYMax is the last row to mark (inclusive).
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void Sharp96x96_MarkLinesDirty(uint16_t uiYMin, uint16_t uiYMax)
+{
+	uint16_t yi;
+
+	for(yi = uiYMin; yi <= uiYMax; yi++)
+	{
+		MarkLineDirty(yi);
+	}
+}
+
+//*****************************************************************************
+//
+//! Sets or clears the dirty flag of every DisplayBuffer row.
+//!
+//! \param ucValue is 0xFF to mark all rows dirty or 0x00 to mark them clean.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void Sharp96x96_SetAllLines(uint8_t ucValue)
+{
+	uint16_t i;
+
+	for(i = 0; i < (LCD_VERTICAL_MAX>>3); i++)
+	{
+		DirtyLines[i] = ucValue;
+	}
+}
 
 //*******************************************************************************
 //
@@ -109,6 +272,322 @@ uint8_t reverse(uint8_t x)
   return b;
 }
 
+//*****************************************************************************
+//
+// The drawing primitives below are split in two layers. The kernels work in
+// DisplayBuffer space, where bit (0x80 >> (bx & 0x7)) of DisplayData(by, bx>>3)
+// is one pixel, and know nothing about the screen orientation. The entry
+// points called by the graphics library map their coordinates once and pick
+// the kernel that suits the mapped shape, so with ROTATE_90 a horizontal line
+// becomes a single column write rather than a pixel by pixel transform.
+//
+// With ROTATE_90 a screen row is a DisplayBuffer column. Rows of pixels passed
+// to Sharp96x96_DrawMultiple are therefore collected in a tile of up to eight
+// screen rows which share one DisplayBuffer byte column, and written out one
+// transposed 8x8 block at a time. Every other primitive, and the flush, first
+// writes out any pending tile so drawing order is preserved.
+//
+//*****************************************************************************
+#ifdef ROTATE_90
+static void *TileDisplayData;
+static int16_t TileX;
+static int16_t TileY;
+static int16_t TileCount;
+static uint8_t TileRows = 0;
+static uint8_t TileData[8][LCD_HORIZONTAL_MAX>>3];
+
+static void Sharp96x96_FlushTile(void);
+
+#define DrainTile()			do { if(TileRows) Sharp96x96_FlushTile(); } while(0)
+#define DiscardTile()		(TileRows = 0)
+#else
+#define DrainTile()
+#define DiscardTile()
+#endif
+
+//*****************************************************************************
+//
+//! Fills a block of DisplayBuffer pixels.
+//!
+//! \param pvDisplayData is a pointer to the driver-specific data for this
+//! display driver.
+//! \param lXMin is the first DisplayBuffer column of the block.
+//! \param lXMax is the last DisplayBuffer column of the block (inclusive).
+//! \param lYMin is the first DisplayBuffer row of the block.
+//! \param lYMax is the last DisplayBuffer row of the block (inclusive).
+//! \param ulValue is the color of the block.
+//!
+//! This is the kernel behind horizontal lines and rectangles. Partial bytes
+//! at either end of a row are masked, whole bytes in between are stored.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void Sharp96x96_FillBlock(void *pvDisplayData, int16_t lXMin,
+                                 int16_t lXMax, int16_t lYMin, int16_t lYMax,
+                                 uint16_t ulValue)
+{
+	uint16_t xi, x_index_min = lXMin>>3, x_index_max = lXMax>>3;
+	int16_t yi;
+	uint8_t *pucData, ucfirst_x_byte, uclast_x_byte;
+	uint8_t ucFill = (ClrBlack == ulValue) ? SHARP_BLACK : SHARP_WHITE;
+
+	//calculate first byte
+	//mod by 8 and shift this # bits
+	ucfirst_x_byte = (0xFF >> (lXMin & 0x7));
+
+	//calculate last byte
+	//mod by 8 and shift this # bits
+	uclast_x_byte = (0xFF << (7-(lXMax & 0x7)));
+
+	//only one data byte per row
+	if(x_index_min == x_index_max)
+	{
+		ucfirst_x_byte &= uclast_x_byte;
+
+		pucData = &DisplayData(lYMin, x_index_min);
+		for(yi = lYMin; yi <= lYMax; yi++)
+		{
+			*pucData = (*pucData & ~ucfirst_x_byte) | (ucFill & ucfirst_x_byte);
+			pucData += LCD_ROW_STRIDE;
+		}
+	}
+	else
+	{
+		for(yi = lYMin; yi <= lYMax; yi++)
+		{
+			//set buffer to correct location
+			pucData = &DisplayData(yi, x_index_min);
+
+			//write first byte
+			*pucData = (*pucData & ~ucfirst_x_byte) | (ucFill & ucfirst_x_byte);
+			pucData++;
+
+			//write middle bytes
+			for(xi = x_index_min + 1; xi < x_index_max; xi++)
+			{
+				*pucData++ = ucFill;
+			}
+
+			//write last byte
+			*pucData = (*pucData & ~uclast_x_byte) | (ucFill & uclast_x_byte);
+		}
+	}
+
+	Sharp96x96_MarkLinesDirty(lYMin, lYMax);
+}
+
+//*****************************************************************************
+//
+//! Fills part of a single DisplayBuffer column.
+//!
+//! \param pvDisplayData is a pointer to the driver-specific data for this
+//! display driver.
+//! \param lX is the DisplayBuffer column.
+//! \param lYMin is the first DisplayBuffer row.
+//! \param lYMax is the last DisplayBuffer row (inclusive).
+//! \param ulValue is the color of the pixels.
+//!
+//! This is the kernel behind vertical lines. The bit mask is computed once
+//! and the row pointer steps by the row stride.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void Sharp96x96_FillColumn(void *pvDisplayData, int16_t lX,
+                                  int16_t lYMin, int16_t lYMax,
+                                  uint16_t ulValue)
+{
+	uint8_t *pucData = &DisplayData(lYMin, lX>>3);
+	uint8_t data_byte = (0x80 >> (lX & 0x7));
+	int16_t yi;
+
+	//black pixels (clear bits)
+	if(ClrBlack == ulValue)
+	{
+		data_byte = ~data_byte;
+		for(yi = lYMin; yi <= lYMax; yi++)
+		{
+			*pucData &= data_byte;
+			pucData += LCD_ROW_STRIDE;
+		}
+	}
+	//white pixels (set bits)
+	else
+	{
+		for(yi = lYMin; yi <= lYMax; yi++)
+		{
+			*pucData |= data_byte;
+			pucData += LCD_ROW_STRIDE;
+		}
+	}
+
+	Sharp96x96_MarkLinesDirty(lYMin, lYMax);
+}
+
+//*****************************************************************************
+//
+//! Converts a sequence of image pixels to 1 bit per pixel.
+//!
+//! \param pucBits receives the pixels, most significant bit first.
+//! \param lX0 is sub-pixel offset within the pixel data.
+//! \param lCount is the number of pixels to convert.
+//! \param lBPP is the number of bits per pixel; must be 1, 4, or 8.
+//! \param pucData is a pointer to the pixel data.
+//! \param pucPalette is a pointer to the palette of the pixel data.
+//!
+//! For 1 bit per pixel data the palette holds translated colors and is
+//! applied a byte at a time. Other formats are translated pixel by pixel.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void Sharp96x96_UnpackPixels(uint8_t *pucBits, int16_t lX0,
+                                    int16_t lCount, int16_t lBPP,
+                                    const uint8_t *pucData,
+                                    const uint32_t *pucPalette)
+{
+	int16_t xi;
+	uint8_t ucShift, ucByte, ucIndex, ucWhite0, ucWhite1;
+	uint32_t ulColor;
+
+	if(1 == lBPP)
+	{
+		ucShift = lX0 & 0x7;
+
+		// Masks which turn a 0 or 1 bit into the palette color
+		ucWhite0 = (pucPalette && pucPalette[0]) ? 0xFF : 0x00;
+		ucWhite1 = (!pucPalette || pucPalette[1]) ? 0xFF : 0x00;
+
+		for(xi = 0; xi < lCount; xi += 8)
+		{
+			ucByte = *pucData++ << ucShift;
+			if(ucShift && ((xi + 8) < (lCount + ucShift)))
+			{
+				ucByte |= *pucData >> (8 - ucShift);
+			}
+
+			*pucBits++ = (ucByte & ucWhite1) | (~ucByte & ucWhite0);
+		}
+		return;
+	}
+
+	for(xi = 0; xi < ((lCount + 7) >> 3); xi++)
+	{
+		pucBits[xi] = 0;
+	}
+
+	for(xi = 0; xi < lCount; xi++)
+	{
+		if(4 == lBPP)
+		{
+			ucByte = pucData[(lX0 + xi) >> 1];
+			ucIndex = ((lX0 + xi) & 0x1) ? (ucByte & 0x0F) : (ucByte >> 4);
+		}
+		else
+		{
+			ucIndex = pucData[xi];
+		}
+
+		ulColor = pucPalette[ucIndex];
+		if(DPYCOLORTRANSLATE(ulColor) != 0)
+		{
+			pucBits[xi >> 3] |= (0x80 >> (xi & 0x7));
+		}
+	}
+}
+
+#ifdef ROTATE_90
+//*****************************************************************************
+//
+//! Transposes an 8x8 block of pixels in place.
+//!
+//! \param pucBlock holds eight rows of eight pixels, most significant bit
+//! first, and receives the eight columns.
+//!
+//! Afterwards bit (0x80 >> r) of pucBlock[c] is what bit (0x80 >> c) of
+//! pucBlock[r] was. The swaps of 1x1, 2x2 and 4x4 sub-blocks are done on the
+//! whole block at once instead of bit by bit.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void Sharp96x96_Transpose8x8(uint8_t *pucBlock)
+{
+	uint32_t x, y, t;
+
+	x = ((uint32_t)pucBlock[0] << 24) | ((uint32_t)pucBlock[1] << 16) |
+	    ((uint16_t)pucBlock[2] << 8) | pucBlock[3];
+	y = ((uint32_t)pucBlock[4] << 24) | ((uint32_t)pucBlock[5] << 16) |
+	    ((uint16_t)pucBlock[6] << 8) | pucBlock[7];
+
+	t = (x ^ (x >> 7)) & 0x00AA00AA;  x = x ^ t ^ (t << 7);
+	t = (y ^ (y >> 7)) & 0x00AA00AA;  y = y ^ t ^ (t << 7);
+
+	t = (x ^ (x >> 14)) & 0x0000CCCC;  x = x ^ t ^ (t << 14);
+	t = (y ^ (y >> 14)) & 0x0000CCCC;  y = y ^ t ^ (t << 14);
+
+	t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+	y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+	x = t;
+
+	pucBlock[0] = x >> 24; pucBlock[1] = x >> 16;
+	pucBlock[2] = x >> 8;  pucBlock[3] = x;
+	pucBlock[4] = y >> 24; pucBlock[5] = y >> 16;
+	pucBlock[6] = y >> 8;  pucBlock[7] = y;
+}
+
+//*****************************************************************************
+//
+//! Writes the pending tile of screen rows to the DisplayBuffer.
+//!
+//! Screen column x of the tile is DisplayBuffer row LCD_HORIZONTAL_MAX-x-1,
+//! and the tile's screen rows are bits of a single byte in that row. Each
+//! group of eight screen columns is transposed and stored with one masked
+//! write per DisplayBuffer row, leaving bits of rows not in the tile alone.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void Sharp96x96_FlushTile(void)
+{
+	void *pvDisplayData = TileDisplayData;
+	uint8_t aucBlock[8];
+	uint8_t ucRows = TileRows;
+	uint16_t x_index = TileY >> 3;
+	int16_t xi, xj, lY;
+	uint8_t i, *pucData;
+
+	TileRows = 0;
+
+#ifdef NON_VOLATILE_MEMORY_BUFFER
+	PrepareMemoryWrite();
+#endif
+
+	for(xi = 0; xi < TileCount; xi += 8)
+	{
+		for(i = 0; i < 8; i++)
+		{
+			aucBlock[i] = TileData[i][xi >> 3];
+		}
+
+		Sharp96x96_Transpose8x8(aucBlock);
+
+		lY = LCD_HORIZONTAL_MAX - TileX - xi - 1;
+		for(xj = 0; (xj < 8) && ((xi + xj) < TileCount); xj++, lY--)
+		{
+			pucData = &DisplayData(lY, x_index);
+			*pucData = (*pucData & ~ucRows) | (aucBlock[xj] & ucRows);
+			MarkLineDirty(lY);
+		}
+	}
+
+#ifdef NON_VOLATILE_MEMORY_BUFFER
+	FinishMemoryWrite();
+#endif
+}
+#endif //ROTATE_90
+
 //*****************************************************************************
 //
 //! Draws a pixel on the screen.
@@ -128,6 +607,8 @@ uint8_t reverse(uint8_t x)
 void Sharp96x96_PixelDraw(void *pvDisplayData, int16_t lX, int16_t lY,
                                    uint16_t ulValue)
 {
+	DrainTile();
+
 #ifdef ROTATE_90
 	uint16_t temp = lX;
 	lX = lY;
@@ -140,11 +621,13 @@ void Sharp96x96_PixelDraw(void *pvDisplayData, int16_t lX, int16_t lY,
 #endif
 
 	if(ClrBlack == ulValue){
-		DisplayBuffer[lY][lX>>3] &= ~(0x80 >> (lX & 0x7));
+		DisplayData(lY, lX>>3) &= ~(0x80 >> (lX & 0x7));
 	}else{
-		DisplayBuffer[lY][lX>>3] |= (0x80 >> (lX & 0x7));
+		DisplayData(lY, lX>>3) |= (0x80 >> (lX & 0x7));
 	}
 
+	MarkLineDirty(lY);
+
 #ifdef NON_VOLATILE_MEMORY_BUFFER
 	FinishMemoryWrite();
 #endif
@@ -172,9 +655,9 @@ void Sharp96x96_PixelDraw(void *pvDisplayData, int16_t lX, int16_t lY,
 //! contains 24-bit RGB values that must be translated before being written to
 //! the display.
 //!
-//! NOTE:  This function currently does not support 90 degree rotation.
-//! A workaround for now is to rotate images 90 degrees when creating
-//! them.
+//! The pixels may start at any X coordinate. With ROTATE_90 the row is added
+//! to the pending tile, which is written out once it holds eight rows or the
+//! next call does not continue the same image.
 //!
 //! \return None.
 //
@@ -184,26 +667,67 @@ static void Sharp96x96_DrawMultiple(void *pvDisplayData, int16_t lX,
                                            int16_t lBPP,
                                            const uint8_t *pucData,
                                            const uint32_t *pucPalette)
-{  
+{
+#ifdef ROTATE_90
+	uint8_t ucRow = 0x80 >> (lY & 0x7);
+
+	// Only rows of the same image column which share a byte column can be
+	// combined into one tile
+	if(TileRows && ((TileRows & ucRow) || (TileX != lX) || (TileCount != lCount) ||
+	   ((TileY >> 3) != (lY >> 3)) || (TileDisplayData != pvDisplayData)))
+	{
+		Sharp96x96_FlushTile();
+	}
 
-	uint8_t *pData = &DisplayBuffer[lY][lX>>3];
-	uint16_t xj = 0;
+	TileDisplayData = pvDisplayData;
+	TileX = lX;
+	TileY = lY;
+	TileCount = lCount;
+
+	Sharp96x96_UnpackPixels(TileData[lY & 0x7], lX0, lCount, lBPP, pucData,
+	                        pucPalette);
+	TileRows |= ucRow;
+
+	if(0xFF == TileRows)
+	{
+		Sharp96x96_FlushTile();
+	}
+#else
+	uint8_t aucBits[LCD_HORIZONTAL_MAX>>3];
+	const uint8_t *pucBits = aucBits;
+	uint8_t *pData = &DisplayData(lY, lX>>3);
+	uint8_t ucShift = lX & 0x7;
+	uint8_t ucMask, ucByte;
+
+	Sharp96x96_UnpackPixels(aucBits, lX0, lCount, lBPP, pucData, pucPalette);
 
 #ifdef NON_VOLATILE_MEMORY_BUFFER
 	PrepareMemoryWrite();
 #endif
 
-	//Write bytes of data to the display buffer
-	for(xj=0;xj<lCount>>3;xj++){
-		*pData++ = *pucData++;
+	//Write the pixels a source byte at a time, each one straddling at most
+	//two bytes of the display buffer
+	for(; lCount > 0; lCount -= 8)
+	{
+		ucMask = (lCount >= 8) ? 0xFF : (uint8_t)(0xFF << (8 - lCount));
+		ucByte = *pucBits++ & ucMask;
+
+		*pData = (*pData & ~(ucMask >> ucShift)) | (ucByte >> ucShift);
+		pData++;
+
+		ucMask = (uint8_t)(ucMask << (8 - ucShift));
+		if(ucShift && ucMask)
+		{
+			*pData = (*pData & ~ucMask) | (uint8_t)(ucByte << (8 - ucShift));
+		}
 	}
 
-	//Write last data byte to the display buffer
-	*pData = (*pData & (0xFF >> (lCount & 0x7))) | *pucData;
+	MarkLineDirty(lY);
 
 #ifdef NON_VOLATILE_MEMORY_BUFFER
 	FinishMemoryWrite();
 #endif
+#endif //ROTATE_90
 }
 //*****************************************************************************
 //
@@ -225,84 +749,1815 @@ static void Sharp96x96_DrawMultiple(void *pvDisplayData, int16_t lX,
 static void Sharp96x96_LineDrawH(void *pvDisplayData, int16_t lX1, int16_t lX2,
                                    int16_t lY, uint16_t ulValue)
 {
+	DrainTile();
+
+#ifdef NON_VOLATILE_MEMORY_BUFFER
+	PrepareMemoryWrite();
+#endif
+
 #ifdef ROTATE_90
-	uint16_t temp = lX1;
-	lX1 = lX2;
-	lX2 = lY;
-	lY = LCD_HORIZONTAL_MAX - temp - 1;
+	Sharp96x96_FillColumn(pvDisplayData, lY, LCD_HORIZONTAL_MAX - lX2 - 1,
+	                      LCD_HORIZONTAL_MAX - lX1 - 1, ulValue);
+#else
+	Sharp96x96_FillBlock(pvDisplayData, lX1, lX2, lY, lY, ulValue);
+#endif
+
+#ifdef NON_VOLATILE_MEMORY_BUFFER
+	FinishMemoryWrite();
 #endif
+}
 
-	volatile uint16_t xi = 0;
-	volatile uint16_t x_index_min = lX1>>3;
-	volatile uint16_t x_index_max = lX2>>3;
-	volatile uint8_t *pucData, ucfirst_x_byte, uclast_x_byte;
+
+//*****************************************************************************
+//
+//! Draws a vertical line.
+//!
+//! \param pvDisplayData is a pointer to the driver-specific data for this
+//! display driver.
+//! \param lX is the X coordinate of the line.
+//! \param lY1 is the Y coordinate of the start of the line.
+//! \param lY2 is the Y coordinate of the end of the line.
+//! \param ulValue is the color of the line.
+//!
+//! This function draws a vertical line on the display.  The coordinates of the
+//! line are assumed to be within the extents of the display.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void Sharp96x96_LineDrawV(void *pvDisplayData, int16_t lX, int16_t lY1,
+                                   int16_t lY2, uint16_t ulValue)
+{
+	DrainTile();
 
 #ifdef NON_VOLATILE_MEMORY_BUFFER
 	PrepareMemoryWrite();
 #endif
 
-	//calculate first byte
-	//mod by 8 and shift this # bits
-	ucfirst_x_byte = (0xFF >> (lX1 & 0x7));    
-	//calculate last byte
-	//mod by 8 and shift this # bits
-	uclast_x_byte = (0xFF << (7-(lX2 & 0x7))); 
+#ifdef ROTATE_90
+	Sharp96x96_FillBlock(pvDisplayData, lY1, lY2, LCD_HORIZONTAL_MAX - lX - 1,
+	                     LCD_HORIZONTAL_MAX - lX - 1, ulValue);
+#else
+	Sharp96x96_FillColumn(pvDisplayData, lX, lY1, lY2, ulValue);
+#endif
+
+#ifdef NON_VOLATILE_MEMORY_BUFFER
+	FinishMemoryWrite();
+#endif
+}
+
+//*****************************************************************************
+//
+//! Fills a rectangle.
+//!
+//! \param pvDisplayData is a pointer to the driver-specific data for this
+//! display driver.
+//! \param pRect is a pointer to the structure describing the rectangle.
+//! \param ulValue is the color of the rectangle.
+//!
+//! This function fills a rectangle on the display.  The coordinates of the
+//! rectangle are assumed to be within the extents of the display, and the
+//! rectangle specification is fully inclusive (in other words, both sXMin and
+//! sXMax are drawn, along with sYMin and sYMax).
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void Sharp96x96_RectFill(void *pvDisplayData, const tRectangle *pRect,
+                                  uint16_t ulValue)
+{
+	DrainTile();
 
-	//check if more than one data byte
-	if(x_index_min != x_index_max){
+#ifdef NON_VOLATILE_MEMORY_BUFFER
+	PrepareMemoryWrite();
+#endif
 
-		//set buffer to correct location
-		pucData = &DisplayBuffer[lY][x_index_min];
+#ifdef ROTATE_90
+	Sharp96x96_FillBlock(pvDisplayData, pRect->sYMin, pRect->sYMax,
+	                     LCD_HORIZONTAL_MAX - pRect->sXMax - 1,
+	                     LCD_HORIZONTAL_MAX - pRect->sXMin - 1, ulValue);
+#else
+	Sharp96x96_FillBlock(pvDisplayData, pRect->sXMin, pRect->sXMax,
+	                     pRect->sYMin, pRect->sYMax, ulValue);
+#endif
 
-		//black pixels (clear bits)
-		if(ClrBlack == ulValue)
-		{
-			//write first byte
-			*pucData++ &= ~ucfirst_x_byte;
+#ifdef NON_VOLATILE_MEMORY_BUFFER
+	FinishMemoryWrite();
+#endif
+}
 
-			//write middle bytes
-			for(xi = x_index_min; xi < x_index_max-1; xi++)
-			{
-				*pucData++ = 0x00;
-			}
+//*****************************************************************************
+//
+// Glyphs of g_sFontFixed6x8 in DisplayBuffer orientation, pre-shifted.
+// Glyphs[s][i] holds the glyph of character ' ' + i shifted right by s bits,
+// one word per DisplayBuffer row the glyph covers: the 8 screen rows of each
+// of the 6 columns with ROTATE_90, otherwise the 6 left aligned pixels of
+// each of the 8 rows. The high byte goes into the DisplayBuffer byte the
+// glyph starts in and the low byte into the next one, so a glyph is drawn
+// with at most two masked byte writes per DisplayBuffer row and no shifts.
+// The tables are made from the font data in fonts/fontfixed6x8.c and take
+// 9120 bytes of flash with ROTATE_90, 12160 without.
+//
+//*****************************************************************************
+#define GLYPH_WIDTH			6
+#define GLYPH_HEIGHT		8
+#define GLYPH_COUNT			95
 
-			//write last byte
-			*pucData &= ~uclast_x_byte;
-		}
-		//white pixels (set bits)
-		else
-		{
-			//write first byte
-			*pucData++ |= ucfirst_x_byte;
+#ifdef ROTATE_90
+#define GLYPH_LINES			GLYPH_WIDTH
+#define GLYPH_CELL			0xFF
+#else
+#define GLYPH_LINES			GLYPH_HEIGHT
+#define GLYPH_CELL			0xFC
+#endif
 
-			//write middle bytes
-			for(xi = x_index_min; xi < x_index_max-1; xi++)
-			{
-				*pucData++ = 0xFF;
-			}
+static const uint16_t Glyphs[8][GLYPH_COUNT][GLYPH_LINES] =
+{
+#ifdef ROTATE_90
+	{	// shifted right by 0
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// ' '
+		{0x0000, 0x0000, 0xF200, 0x0000, 0x0000, 0x0000},	// '!'
+		{0x0000, 0xE000, 0x0000, 0xE000, 0x0000, 0x0000},	// '"'
+		{0x2800, 0xFE00, 0x2800, 0xFE00, 0x2800, 0x0000},	// '#'
+		{0x2400, 0x5400, 0xFE00, 0x5400, 0x4800, 0x0000},	// '$'
+		{0xC400, 0xC800, 0x1000, 0x2600, 0x4600, 0x0000},	// '%'
+		{0x6C00, 0x9200, 0xAA00, 0x4400, 0x0A00, 0x0000},	// '&'
+		{0x0000, 0xA000, 0xC000, 0x0000, 0x0000, 0x0000},	// '''
+		{0x0000, 0x3800, 0x4400, 0x8200, 0x0000, 0x0000},	// '('
+		{0x0000, 0x8200, 0x4400, 0x3800, 0x0000, 0x0000},	// ')'
+		{0x2800, 0x1000, 0x7C00, 0x1000, 0x2800, 0x0000},	// '*'
+		{0x1000, 0x1000, 0x7C00, 0x1000, 0x1000, 0x0000},	// '+'
+		{0x0000, 0x0A00, 0x0C00, 0x0000, 0x0000, 0x0000},	// ','
+		{0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x0000},	// '-'
+		{0x0000, 0x0600, 0x0600, 0x0000, 0x0000, 0x0000},	// '.'
+		{0x0400, 0x0800, 0x1000, 0x2000, 0x4000, 0x0000},	// '/'
+		{0x7C00, 0x8A00, 0x9200, 0xA200, 0x7C00, 0x0000},	// '0'
+		{0x0000, 0x4200, 0xFE00, 0x0200, 0x0000, 0x0000},	// '1'
+		{0x4200, 0x8600, 0x8A00, 0x9200, 0x6200, 0x0000},	// '2'
+		{0x8400, 0x8200, 0xA200, 0xD200, 0x8C00, 0x0000},	// '3'
+		{0x1800, 0x2800, 0x4800, 0xFE00, 0x0800, 0x0000},	// '4'
+		{0xE400, 0xA200, 0xA200, 0xA200, 0x9C00, 0x0000},	// '5'
+		{0x3C00, 0x5200, 0x9200, 0x9200, 0x0C00, 0x0000},	// '6'
+		{0x8000, 0x8E00, 0x9000, 0xA000, 0xC000, 0x0000},	// '7'
+		{0x6C00, 0x9200, 0x9200, 0x9200, 0x6C00, 0x0000},	// '8'
+		{0x6000, 0x9200, 0x9200, 0x9400, 0x7800, 0x0000},	// '9'
+		{0x0000, 0x6C00, 0x6C00, 0x0000, 0x0000, 0x0000},	// ':'
+		{0x0000, 0x6A00, 0x6C00, 0x0000, 0x0000, 0x0000},	// ';'
+		{0x1000, 0x2800, 0x4400, 0x8200, 0x0000, 0x0000},	// '<'
+		{0x2800, 0x2800, 0x2800, 0x2800, 0x2800, 0x0000},	// '='
+		{0x0000, 0x8200, 0x4400, 0x2800, 0x1000, 0x0000},	// '>'
+		{0x4000, 0x8000, 0x8A00, 0x9000, 0x6000, 0x0000},	// '?'
+		{0x4C00, 0x9200, 0x9E00, 0x8200, 0x7C00, 0x0000},	// '@'
+		{0x7E00, 0x8800, 0x8800, 0x8800, 0x7E00, 0x0000},	// 'A'
+		{0xFE00, 0x9200, 0x9200, 0x9200, 0x6C00, 0x0000},	// 'B'
+		{0x7C00, 0x8200, 0x8200, 0x8200, 0x4400, 0x0000},	// 'C'
+		{0xFE00, 0x8200, 0x8200, 0x4400, 0x3800, 0x0000},	// 'D'
+		{0xFE00, 0x9200, 0x9200, 0x9200, 0x8200, 0x0000},	// 'E'
+		{0xFE00, 0x9000, 0x9000, 0x9000, 0x8000, 0x0000},	// 'F'
+		{0x7C00, 0x8200, 0x9200, 0x9200, 0x5E00, 0x0000},	// 'G'
+		{0xFE00, 0x1000, 0x1000, 0x1000, 0xFE00, 0x0000},	// 'H'
+		{0x0000, 0x8200, 0xFE00, 0x8200, 0x0000, 0x0000},	// 'I'
+		{0x0400, 0x0200, 0x8200, 0xFC00, 0x8000, 0x0000},	// 'J'
+		{0xFE00, 0x1000, 0x2800, 0x4400, 0x8200, 0x0000},	// 'K'
+		{0xFE00, 0x0200, 0x0200, 0x0200, 0x0200, 0x0000},	// 'L'
+		{0xFE00, 0x4000, 0x3000, 0x4000, 0xFE00, 0x0000},	// 'M'
+		{0xFE00, 0x2000, 0x1000, 0x0800, 0xFE00, 0x0000},	// 'N'
+		{0x7C00, 0x8200, 0x8200, 0x8200, 0x7C00, 0x0000},	// 'O'
+		{0xFE00, 0x9000, 0x9000, 0x9000, 0x6000, 0x0000},	// 'P'
+		{0x7C00, 0x8200, 0x8A00, 0x8400, 0x7A00, 0x0000},	// 'Q'
+		{0xFE00, 0x9000, 0x9800, 0x9400, 0x6200, 0x0000},	// 'R'
+		{0x6200, 0x9200, 0x9200, 0x9200, 0x8C00, 0x0000},	// 'S'
+		{0x8000, 0x8000, 0xFE00, 0x8000, 0x8000, 0x0000},	// 'T'
+		{0xFC00, 0x0200, 0x0200, 0x0200, 0xFC00, 0x0000},	// 'U'
+		{0xF800, 0x0400, 0x0200, 0x0400, 0xF800, 0x0000},	// 'V'
+		{0xFC00, 0x0200, 0x1C00, 0x0200, 0xFC00, 0x0000},	// 'W'
+		{0xC600, 0x2800, 0x1000, 0x2800, 0xC600, 0x0000},	// 'X'
+		{0xE000, 0x1000, 0x0E00, 0x1000, 0xE000, 0x0000},	// 'Y'
+		{0x8600, 0x8A00, 0x9200, 0xA200, 0xC200, 0x0000},	// 'Z'
+		{0x0000, 0xFE00, 0x8200, 0x8200, 0x0000, 0x0000},	// '['
+		{0x4000, 0x2000, 0x1000, 0x0800, 0x0400, 0x0000},	// backslash
+		{0x0000, 0x8200, 0x8200, 0xFE00, 0x0000, 0x0000},	// ']'
+		{0x2000, 0x4000, 0x8000, 0x4000, 0x2000, 0x0000},	// '^'
+		{0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0000},	// '_'
+		{0x0000, 0x8000, 0x4000, 0x2000, 0x0000, 0x0000},	// '`'
+		{0x0400, 0x2A00, 0x2A00, 0x2A00, 0x1E00, 0x0000},	// 'a'
+		{0xFE00, 0x1200, 0x2200, 0x2200, 0x1C00, 0x0000},	// 'b'
+		{0x1C00, 0x2200, 0x2200, 0x2200, 0x0400, 0x0000},	// 'c'
+		{0x1C00, 0x2200, 0x2200, 0x1200, 0xFE00, 0x0000},	// 'd'
+		{0x1C00, 0x2A00, 0x2A00, 0x2A00, 0x1800, 0x0000},	// 'e'
+		{0x1000, 0x7E00, 0x9000, 0x8000, 0x4000, 0x0000},	// 'f'
+		{0x3000, 0x4A00, 0x4A00, 0x4A00, 0x7C00, 0x0000},	// 'g'
+		{0xFE00, 0x1000, 0x2000, 0x2000, 0x1E00, 0x0000},	// 'h'
+		{0x0000, 0x2200, 0xBE00, 0x0200, 0x0000, 0x0000},	// 'i'
+		{0x0400, 0x0200, 0x2200, 0xBC00, 0x0000, 0x0000},	// 'j'
+		{0xFE00, 0x0800, 0x1400, 0x2200, 0x0000, 0x0000},	// 'k'
+		{0x0000, 0x8200, 0xFE00, 0x0200, 0x0000, 0x0000},	// 'l'
+		{0x3E00, 0x2000, 0x1800, 0x2000, 0x1E00, 0x0000},	// 'm'
+		{0x3E00, 0x1000, 0x2000, 0x2000, 0x1E00, 0x0000},	// 'n'
+		{0x1C00, 0x2200, 0x2200, 0x2200, 0x1C00, 0x0000},	// 'o'
+		{0x3E00, 0x2800, 0x2800, 0x2800, 0x1000, 0x0000},	// 'p'
+		{0x1000, 0x2800, 0x2800, 0x1800, 0x3E00, 0x0000},	// 'q'
+		{0x3E00, 0x1000, 0x2000, 0x2000, 0x1000, 0x0000},	// 'r'
+		{0x1200, 0x2A00, 0x2A00, 0x2A00, 0x0400, 0x0000},	// 's'
+		{0x2000, 0xFC00, 0x2200, 0x0200, 0x0400, 0x0000},	// 't'
+		{0x3C00, 0x0200, 0x0200, 0x0400, 0x3E00, 0x0000},	// 'u'
+		{0x3800, 0x0400, 0x0200, 0x0400, 0x3800, 0x0000},	// 'v'
+		{0x3C00, 0x0200, 0x0C00, 0x0200, 0x3C00, 0x0000},	// 'w'
+		{0x2200, 0x1400, 0x0800, 0x1400, 0x2200, 0x0000},	// 'x'
+		{0x3000, 0x0A00, 0x0A00, 0x0A00, 0x3C00, 0x0000},	// 'y'
+		{0x2200, 0x2600, 0x2A00, 0x3200, 0x2200, 0x0000},	// 'z'
+		{0x0000, 0x1000, 0x6C00, 0x8200, 0x0000, 0x0000},	// '{'
+		{0x0000, 0x0000, 0xFE00, 0x0000, 0x0000, 0x0000},	// '|'
+		{0x0000, 0x8200, 0x6C00, 0x1000, 0x0000, 0x0000},	// '}'
+		{0x4000, 0x8000, 0x4000, 0x2000, 0x4000, 0x0000},	// '~'
+	},
+	{	// shifted right by 1
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// ' '
+		{0x0000, 0x0000, 0x7900, 0x0000, 0x0000, 0x0000},	// '!'
+		{0x0000, 0x7000, 0x0000, 0x7000, 0x0000, 0x0000},	// '"'
+		{0x1400, 0x7F00, 0x1400, 0x7F00, 0x1400, 0x0000},	// '#'
+		{0x1200, 0x2A00, 0x7F00, 0x2A00, 0x2400, 0x0000},	// '$'
+		{0x6200, 0x6400, 0x0800, 0x1300, 0x2300, 0x0000},	// '%'
+		{0x3600, 0x4900, 0x5500, 0x2200, 0x0500, 0x0000},	// '&'
+		{0x0000, 0x5000, 0x6000, 0x0000, 0x0000, 0x0000},	// '''
+		{0x0000, 0x1C00, 0x2200, 0x4100, 0x0000, 0x0000},	// '('
+		{0x0000, 0x4100, 0x2200, 0x1C00, 0x0000, 0x0000},	// ')'
+		{0x1400, 0x0800, 0x3E00, 0x0800, 0x1400, 0x0000},	// '*'
+		{0x0800, 0x0800, 0x3E00, 0x0800, 0x0800, 0x0000},	// '+'
+		{0x0000, 0x0500, 0x0600, 0x0000, 0x0000, 0x0000},	// ','
+		{0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0000},	// '-'
+		{0x0000, 0x0300, 0x0300, 0x0000, 0x0000, 0x0000},	// '.'
+		{0x0200, 0x0400, 0x0800, 0x1000, 0x2000, 0x0000},	// '/'
+		{0x3E00, 0x4500, 0x4900, 0x5100, 0x3E00, 0x0000},	// '0'
+		{0x0000, 0x2100, 0x7F00, 0x0100, 0x0000, 0x0000},	// '1'
+		{0x2100, 0x4300, 0x4500, 0x4900, 0x3100, 0x0000},	// '2'
+		{0x4200, 0x4100, 0x5100, 0x6900, 0x4600, 0x0000},	// '3'
+		{0x0C00, 0x1400, 0x2400, 0x7F00, 0x0400, 0x0000},	// '4'
+		{0x7200, 0x5100, 0x5100, 0x5100, 0x4E00, 0x0000},	// '5'
+		{0x1E00, 0x2900, 0x4900, 0x4900, 0x0600, 0x0000},	// '6'
+		{0x4000, 0x4700, 0x4800, 0x5000, 0x6000, 0x0000},	// '7'
+		{0x3600, 0x4900, 0x4900, 0x4900, 0x3600, 0x0000},	// '8'
+		{0x3000, 0x4900, 0x4900, 0x4A00, 0x3C00, 0x0000},	// '9'
+		{0x0000, 0x3600, 0x3600, 0x0000, 0x0000, 0x0000},	// ':'
+		{0x0000, 0x3500, 0x3600, 0x0000, 0x0000, 0x0000},	// ';'
+		{0x0800, 0x1400, 0x2200, 0x4100, 0x0000, 0x0000},	// '<'
+		{0x1400, 0x1400, 0x1400, 0x1400, 0x1400, 0x0000},	// '='
+		{0x0000, 0x4100, 0x2200, 0x1400, 0x0800, 0x0000},	// '>'
+		{0x2000, 0x4000, 0x4500, 0x4800, 0x3000, 0x0000},	// '?'
+		{0x2600, 0x4900, 0x4F00, 0x4100, 0x3E00, 0x0000},	// '@'
+		{0x3F00, 0x4400, 0x4400, 0x4400, 0x3F00, 0x0000},	// 'A'
+		{0x7F00, 0x4900, 0x4900, 0x4900, 0x3600, 0x0000},	// 'B'
+		{0x3E00, 0x4100, 0x4100, 0x4100, 0x2200, 0x0000},	// 'C'
+		{0x7F00, 0x4100, 0x4100, 0x2200, 0x1C00, 0x0000},	// 'D'
+		{0x7F00, 0x4900, 0x4900, 0x4900, 0x4100, 0x0000},	// 'E'
+		{0x7F00, 0x4800, 0x4800, 0x4800, 0x4000, 0x0000},	// 'F'
+		{0x3E00, 0x4100, 0x4900, 0x4900, 0x2F00, 0x0000},	// 'G'
+		{0x7F00, 0x0800, 0x0800, 0x0800, 0x7F00, 0x0000},	// 'H'
+		{0x0000, 0x4100, 0x7F00, 0x4100, 0x0000, 0x0000},	// 'I'
+		{0x0200, 0x0100, 0x4100, 0x7E00, 0x4000, 0x0000},	// 'J'
+		{0x7F00, 0x0800, 0x1400, 0x2200, 0x4100, 0x0000},	// 'K'
+		{0x7F00, 0x0100, 0x0100, 0x0100, 0x0100, 0x0000},	// 'L'
+		{0x7F00, 0x2000, 0x1800, 0x2000, 0x7F00, 0x0000},	// 'M'
+		{0x7F00, 0x1000, 0x0800, 0x0400, 0x7F00, 0x0000},	// 'N'
+		{0x3E00, 0x4100, 0x4100, 0x4100, 0x3E00, 0x0000},	// 'O'
+		{0x7F00, 0x4800, 0x4800, 0x4800, 0x3000, 0x0000},	// 'P'
+		{0x3E00, 0x4100, 0x4500, 0x4200, 0x3D00, 0x0000},	// 'Q'
+		{0x7F00, 0x4800, 0x4C00, 0x4A00, 0x3100, 0x0000},	// 'R'
+		{0x3100, 0x4900, 0x4900, 0x4900, 0x4600, 0x0000},	// 'S'
+		{0x4000, 0x4000, 0x7F00, 0x4000, 0x4000, 0x0000},	// 'T'
+		{0x7E00, 0x0100, 0x0100, 0x0100, 0x7E00, 0x0000},	// 'U'
+		{0x7C00, 0x0200, 0x0100, 0x0200, 0x7C00, 0x0000},	// 'V'
+		{0x7E00, 0x0100, 0x0E00, 0x0100, 0x7E00, 0x0000},	// 'W'
+		{0x6300, 0x1400, 0x0800, 0x1400, 0x6300, 0x0000},	// 'X'
+		{0x7000, 0x0800, 0x0700, 0x0800, 0x7000, 0x0000},	// 'Y'
+		{0x4300, 0x4500, 0x4900, 0x5100, 0x6100, 0x0000},	// 'Z'
+		{0x0000, 0x7F00, 0x4100, 0x4100, 0x0000, 0x0000},	// '['
+		{0x2000, 0x1000, 0x0800, 0x0400, 0x0200, 0x0000},	// backslash
+		{0x0000, 0x4100, 0x4100, 0x7F00, 0x0000, 0x0000},	// ']'
+		{0x1000, 0x2000, 0x4000, 0x2000, 0x1000, 0x0000},	// '^'
+		{0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0000},	// '_'
+		{0x0000, 0x4000, 0x2000, 0x1000, 0x0000, 0x0000},	// '`'
+		{0x0200, 0x1500, 0x1500, 0x1500, 0x0F00, 0x0000},	// 'a'
+		{0x7F00, 0x0900, 0x1100, 0x1100, 0x0E00, 0x0000},	// 'b'
+		{0x0E00, 0x1100, 0x1100, 0x1100, 0x0200, 0x0000},	// 'c'
+		{0x0E00, 0x1100, 0x1100, 0x0900, 0x7F00, 0x0000},	// 'd'
+		{0x0E00, 0x1500, 0x1500, 0x1500, 0x0C00, 0x0000},	// 'e'
+		{0x0800, 0x3F00, 0x4800, 0x4000, 0x2000, 0x0000},	// 'f'
+		{0x1800, 0x2500, 0x2500, 0x2500, 0x3E00, 0x0000},	// 'g'
+		{0x7F00, 0x0800, 0x1000, 0x1000, 0x0F00, 0x0000},	// 'h'
+		{0x0000, 0x1100, 0x5F00, 0x0100, 0x0000, 0x0000},	// 'i'
+		{0x0200, 0x0100, 0x1100, 0x5E00, 0x0000, 0x0000},	// 'j'
+		{0x7F00, 0x0400, 0x0A00, 0x1100, 0x0000, 0x0000},	// 'k'
+		{0x0000, 0x4100, 0x7F00, 0x0100, 0x0000, 0x0000},	// 'l'
+		{0x1F00, 0x1000, 0x0C00, 0x1000, 0x0F00, 0x0000},	// 'm'
+		{0x1F00, 0x0800, 0x1000, 0x1000, 0x0F00, 0x0000},	// 'n'
+		{0x0E00, 0x1100, 0x1100, 0x1100, 0x0E00, 0x0000},	// 'o'
+		{0x1F00, 0x1400, 0x1400, 0x1400, 0x0800, 0x0000},	// 'p'
+		{0x0800, 0x1400, 0x1400, 0x0C00, 0x1F00, 0x0000},	// 'q'
+		{0x1F00, 0x0800, 0x1000, 0x1000, 0x0800, 0x0000},	// 'r'
+		{0x0900, 0x1500, 0x1500, 0x1500, 0x0200, 0x0000},	// 's'
+		{0x1000, 0x7E00, 0x1100, 0x0100, 0x0200, 0x0000},	// 't'
+		{0x1E00, 0x0100, 0x0100, 0x0200, 0x1F00, 0x0000},	// 'u'
+		{0x1C00, 0x0200, 0x0100, 0x0200, 0x1C00, 0x0000},	// 'v'
+		{0x1E00, 0x0100, 0x0600, 0x0100, 0x1E00, 0x0000},	// 'w'
+		{0x1100, 0x0A00, 0x0400, 0x0A00, 0x1100, 0x0000},	// 'x'
+		{0x1800, 0x0500, 0x0500, 0x0500, 0x1E00, 0x0000},	// 'y'
+		{0x1100, 0x1300, 0x1500, 0x1900, 0x1100, 0x0000},	// 'z'
+		{0x0000, 0x0800, 0x3600, 0x4100, 0x0000, 0x0000},	// '{'
+		{0x0000, 0x0000, 0x7F00, 0x0000, 0x0000, 0x0000},	// '|'
+		{0x0000, 0x4100, 0x3600, 0x0800, 0x0000, 0x0000},	// '}'
+		{0x2000, 0x4000, 0x2000, 0x1000, 0x2000, 0x0000},	// '~'
+	},
+	{	// shifted right by 2
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// ' '
+		{0x0000, 0x0000, 0x3C80, 0x0000, 0x0000, 0x0000},	// '!'
+		{0x0000, 0x3800, 0x0000, 0x3800, 0x0000, 0x0000},	// '"'
+		{0x0A00, 0x3F80, 0x0A00, 0x3F80, 0x0A00, 0x0000},	// '#'
+		{0x0900, 0x1500, 0x3F80, 0x1500, 0x1200, 0x0000},	// '$'
+		{0x3100, 0x3200, 0x0400, 0x0980, 0x1180, 0x0000},	// '%'
+		{0x1B00, 0x2480, 0x2A80, 0x1100, 0x0280, 0x0000},	// '&'
+		{0x0000, 0x2800, 0x3000, 0x0000, 0x0000, 0x0000},	// '''
+		{0x0000, 0x0E00, 0x1100, 0x2080, 0x0000, 0x0000},	// '('
+		{0x0000, 0x2080, 0x1100, 0x0E00, 0x0000, 0x0000},	// ')'
+		{0x0A00, 0x0400, 0x1F00, 0x0400, 0x0A00, 0x0000},	// '*'
+		{0x0400, 0x0400, 0x1F00, 0x0400, 0x0400, 0x0000},	// '+'
+		{0x0000, 0x0280, 0x0300, 0x0000, 0x0000, 0x0000},	// ','
+		{0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0000},	// '-'
+		{0x0000, 0x0180, 0x0180, 0x0000, 0x0000, 0x0000},	// '.'
+		{0x0100, 0x0200, 0x0400, 0x0800, 0x1000, 0x0000},	// '/'
+		{0x1F00, 0x2280, 0x2480, 0x2880, 0x1F00, 0x0000},	// '0'
+		{0x0000, 0x1080, 0x3F80, 0x0080, 0x0000, 0x0000},	// '1'
+		{0x1080, 0x2180, 0x2280, 0x2480, 0x1880, 0x0000},	// '2'
+		{0x2100, 0x2080, 0x2880, 0x3480, 0x2300, 0x0000},	// '3'
+		{0x0600, 0x0A00, 0x1200, 0x3F80, 0x0200, 0x0000},	// '4'
+		{0x3900, 0x2880, 0x2880, 0x2880, 0x2700, 0x0000},	// '5'
+		{0x0F00, 0x1480, 0x2480, 0x2480, 0x0300, 0x0000},	// '6'
+		{0x2000, 0x2380, 0x2400, 0x2800, 0x3000, 0x0000},	// '7'
+		{0x1B00, 0x2480, 0x2480, 0x2480, 0x1B00, 0x0000},	// '8'
+		{0x1800, 0x2480, 0x2480, 0x2500, 0x1E00, 0x0000},	// '9'
+		{0x0000, 0x1B00, 0x1B00, 0x0000, 0x0000, 0x0000},	// ':'
+		{0x0000, 0x1A80, 0x1B00, 0x0000, 0x0000, 0x0000},	// ';'
+		{0x0400, 0x0A00, 0x1100, 0x2080, 0x0000, 0x0000},	// '<'
+		{0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0000},	// '='
+		{0x0000, 0x2080, 0x1100, 0x0A00, 0x0400, 0x0000},	// '>'
+		{0x1000, 0x2000, 0x2280, 0x2400, 0x1800, 0x0000},	// '?'
+		{0x1300, 0x2480, 0x2780, 0x2080, 0x1F00, 0x0000},	// '@'
+		{0x1F80, 0x2200, 0x2200, 0x2200, 0x1F80, 0x0000},	// 'A'
+		{0x3F80, 0x2480, 0x2480, 0x2480, 0x1B00, 0x0000},	// 'B'
+		{0x1F00, 0x2080, 0x2080, 0x2080, 0x1100, 0x0000},	// 'C'
+		{0x3F80, 0x2080, 0x2080, 0x1100, 0x0E00, 0x0000},	// 'D'
+		{0x3F80, 0x2480, 0x2480, 0x2480, 0x2080, 0x0000},	// 'E'
+		{0x3F80, 0x2400, 0x2400, 0x2400, 0x2000, 0x0000},	// 'F'
+		{0x1F00, 0x2080, 0x2480, 0x2480, 0x1780, 0x0000},	// 'G'
+		{0x3F80, 0x0400, 0x0400, 0x0400, 0x3F80, 0x0000},	// 'H'
+		{0x0000, 0x2080, 0x3F80, 0x2080, 0x0000, 0x0000},	// 'I'
+		{0x0100, 0x0080, 0x2080, 0x3F00, 0x2000, 0x0000},	// 'J'
+		{0x3F80, 0x0400, 0x0A00, 0x1100, 0x2080, 0x0000},	// 'K'
+		{0x3F80, 0x0080, 0x0080, 0x0080, 0x0080, 0x0000},	// 'L'
+		{0x3F80, 0x1000, 0x0C00, 0x1000, 0x3F80, 0x0000},	// 'M'
+		{0x3F80, 0x0800, 0x0400, 0x0200, 0x3F80, 0x0000},	// 'N'
+		{0x1F00, 0x2080, 0x2080, 0x2080, 0x1F00, 0x0000},	// 'O'
+		{0x3F80, 0x2400, 0x2400, 0x2400, 0x1800, 0x0000},	// 'P'
+		{0x1F00, 0x2080, 0x2280, 0x2100, 0x1E80, 0x0000},	// 'Q'
+		{0x3F80, 0x2400, 0x2600, 0x2500, 0x1880, 0x0000},	// 'R'
+		{0x1880, 0x2480, 0x2480, 0x2480, 0x2300, 0x0000},	// 'S'
+		{0x2000, 0x2000, 0x3F80, 0x2000, 0x2000, 0x0000},	// 'T'
+		{0x3F00, 0x0080, 0x0080, 0x0080, 0x3F00, 0x0000},	// 'U'
+		{0x3E00, 0x0100, 0x0080, 0x0100, 0x3E00, 0x0000},	// 'V'
+		{0x3F00, 0x0080, 0x0700, 0x0080, 0x3F00, 0x0000},	// 'W'
+		{0x3180, 0x0A00, 0x0400, 0x0A00, 0x3180, 0x0000},	// 'X'
+		{0x3800, 0x0400, 0x0380, 0x0400, 0x3800, 0x0000},	// 'Y'
+		{0x2180, 0x2280, 0x2480, 0x2880, 0x3080, 0x0000},	// 'Z'
+		{0x0000, 0x3F80, 0x2080, 0x2080, 0x0000, 0x0000},	// '['
+		{0x1000, 0x0800, 0x0400, 0x0200, 0x0100, 0x0000},	// backslash
+		{0x0000, 0x2080, 0x2080, 0x3F80, 0x0000, 0x0000},	// ']'
+		{0x0800, 0x1000, 0x2000, 0x1000, 0x0800, 0x0000},	// '^'
+		{0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0000},	// '_'
+		{0x0000, 0x2000, 0x1000, 0x0800, 0x0000, 0x0000},	// '`'
+		{0x0100, 0x0A80, 0x0A80, 0x0A80, 0x0780, 0x0000},	// 'a'
+		{0x3F80, 0x0480, 0x0880, 0x0880, 0x0700, 0x0000},	// 'b'
+		{0x0700, 0x0880, 0x0880, 0x0880, 0x0100, 0x0000},	// 'c'
+		{0x0700, 0x0880, 0x0880, 0x0480, 0x3F80, 0x0000},	// 'd'
+		{0x0700, 0x0A80, 0x0A80, 0x0A80, 0x0600, 0x0000},	// 'e'
+		{0x0400, 0x1F80, 0x2400, 0x2000, 0x1000, 0x0000},	// 'f'
+		{0x0C00, 0x1280, 0x1280, 0x1280, 0x1F00, 0x0000},	// 'g'
+		{0x3F80, 0x0400, 0x0800, 0x0800, 0x0780, 0x0000},	// 'h'
+		{0x0000, 0x0880, 0x2F80, 0x0080, 0x0000, 0x0000},	// 'i'
+		{0x0100, 0x0080, 0x0880, 0x2F00, 0x0000, 0x0000},	// 'j'
+		{0x3F80, 0x0200, 0x0500, 0x0880, 0x0000, 0x0000},	// 'k'
+		{0x0000, 0x2080, 0x3F80, 0x0080, 0x0000, 0x0000},	// 'l'
+		{0x0F80, 0x0800, 0x0600, 0x0800, 0x0780, 0x0000},	// 'm'
+		{0x0F80, 0x0400, 0x0800, 0x0800, 0x0780, 0x0000},	// 'n'
+		{0x0700, 0x0880, 0x0880, 0x0880, 0x0700, 0x0000},	// 'o'
+		{0x0F80, 0x0A00, 0x0A00, 0x0A00, 0x0400, 0x0000},	// 'p'
+		{0x0400, 0x0A00, 0x0A00, 0x0600, 0x0F80, 0x0000},	// 'q'
+		{0x0F80, 0x0400, 0x0800, 0x0800, 0x0400, 0x0000},	// 'r'
+		{0x0480, 0x0A80, 0x0A80, 0x0A80, 0x0100, 0x0000},	// 's'
+		{0x0800, 0x3F00, 0x0880, 0x0080, 0x0100, 0x0000},	// 't'
+		{0x0F00, 0x0080, 0x0080, 0x0100, 0x0F80, 0x0000},	// 'u'
+		{0x0E00, 0x0100, 0x0080, 0x0100, 0x0E00, 0x0000},	// 'v'
+		{0x0F00, 0x0080, 0x0300, 0x0080, 0x0F00, 0x0000},	// 'w'
+		{0x0880, 0x0500, 0x0200, 0x0500, 0x0880, 0x0000},	// 'x'
+		{0x0C00, 0x0280, 0x0280, 0x0280, 0x0F00, 0x0000},	// 'y'
+		{0x0880, 0x0980, 0x0A80, 0x0C80, 0x0880, 0x0000},	// 'z'
+		{0x0000, 0x0400, 0x1B00, 0x2080, 0x0000, 0x0000},	// '{'
+		{0x0000, 0x0000, 0x3F80, 0x0000, 0x0000, 0x0000},	// '|'
+		{0x0000, 0x2080, 0x1B00, 0x0400, 0x0000, 0x0000},	// '}'
+		{0x1000, 0x2000, 0x1000, 0x0800, 0x1000, 0x0000},	// '~'
+	},
+	{	// shifted right by 3
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// ' '
+		{0x0000, 0x0000, 0x1E40, 0x0000, 0x0000, 0x0000},	// '!'
+		{0x0000, 0x1C00, 0x0000, 0x1C00, 0x0000, 0x0000},	// '"'
+		{0x0500, 0x1FC0, 0x0500, 0x1FC0, 0x0500, 0x0000},	// '#'
+		{0x0480, 0x0A80, 0x1FC0, 0x0A80, 0x0900, 0x0000},	// '$'
+		{0x1880, 0x1900, 0x0200, 0x04C0, 0x08C0, 0x0000},	// '%'
+		{0x0D80, 0x1240, 0x1540, 0x0880, 0x0140, 0x0000},	// '&'
+		{0x0000, 0x1400, 0x1800, 0x0000, 0x0000, 0x0000},	// '''
+		{0x0000, 0x0700, 0x0880, 0x1040, 0x0000, 0x0000},	// '('
+		{0x0000, 0x1040, 0x0880, 0x0700, 0x0000, 0x0000},	// ')'
+		{0x0500, 0x0200, 0x0F80, 0x0200, 0x0500, 0x0000},	// '*'
+		{0x0200, 0x0200, 0x0F80, 0x0200, 0x0200, 0x0000},	// '+'
+		{0x0000, 0x0140, 0x0180, 0x0000, 0x0000, 0x0000},	// ','
+		{0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0000},	// '-'
+		{0x0000, 0x00C0, 0x00C0, 0x0000, 0x0000, 0x0000},	// '.'
+		{0x0080, 0x0100, 0x0200, 0x0400, 0x0800, 0x0000},	// '/'
+		{0x0F80, 0x1140, 0x1240, 0x1440, 0x0F80, 0x0000},	// '0'
+		{0x0000, 0x0840, 0x1FC0, 0x0040, 0x0000, 0x0000},	// '1'
+		{0x0840, 0x10C0, 0x1140, 0x1240, 0x0C40, 0x0000},	// '2'
+		{0x1080, 0x1040, 0x1440, 0x1A40, 0x1180, 0x0000},	// '3'
+		{0x0300, 0x0500, 0x0900, 0x1FC0, 0x0100, 0x0000},	// '4'
+		{0x1C80, 0x1440, 0x1440, 0x1440, 0x1380, 0x0000},	// '5'
+		{0x0780, 0x0A40, 0x1240, 0x1240, 0x0180, 0x0000},	// '6'
+		{0x1000, 0x11C0, 0x1200, 0x1400, 0x1800, 0x0000},	// '7'
+		{0x0D80, 0x1240, 0x1240, 0x1240, 0x0D80, 0x0000},	// '8'
+		{0x0C00, 0x1240, 0x1240, 0x1280, 0x0F00, 0x0000},	// '9'
+		{0x0000, 0x0D80, 0x0D80, 0x0000, 0x0000, 0x0000},	// ':'
+		{0x0000, 0x0D40, 0x0D80, 0x0000, 0x0000, 0x0000},	// ';'
+		{0x0200, 0x0500, 0x0880, 0x1040, 0x0000, 0x0000},	// '<'
+		{0x0500, 0x0500, 0x0500, 0x0500, 0x0500, 0x0000},	// '='
+		{0x0000, 0x1040, 0x0880, 0x0500, 0x0200, 0x0000},	// '>'
+		{0x0800, 0x1000, 0x1140, 0x1200, 0x0C00, 0x0000},	// '?'
+		{0x0980, 0x1240, 0x13C0, 0x1040, 0x0F80, 0x0000},	// '@'
+		{0x0FC0, 0x1100, 0x1100, 0x1100, 0x0FC0, 0x0000},	// 'A'
+		{0x1FC0, 0x1240, 0x1240, 0x1240, 0x0D80, 0x0000},	// 'B'
+		{0x0F80, 0x1040, 0x1040, 0x1040, 0x0880, 0x0000},	// 'C'
+		{0x1FC0, 0x1040, 0x1040, 0x0880, 0x0700, 0x0000},	// 'D'
+		{0x1FC0, 0x1240, 0x1240, 0x1240, 0x1040, 0x0000},	// 'E'
+		{0x1FC0, 0x1200, 0x1200, 0x1200, 0x1000, 0x0000},	// 'F'
+		{0x0F80, 0x1040, 0x1240, 0x1240, 0x0BC0, 0x0000},	// 'G'
+		{0x1FC0, 0x0200, 0x0200, 0x0200, 0x1FC0, 0x0000},	// 'H'
+		{0x0000, 0x1040, 0x1FC0, 0x1040, 0x0000, 0x0000},	// 'I'
+		{0x0080, 0x0040, 0x1040, 0x1F80, 0x1000, 0x0000},	// 'J'
+		{0x1FC0, 0x0200, 0x0500, 0x0880, 0x1040, 0x0000},	// 'K'
+		{0x1FC0, 0x0040, 0x0040, 0x0040, 0x0040, 0x0000},	// 'L'
+		{0x1FC0, 0x0800, 0x0600, 0x0800, 0x1FC0, 0x0000},	// 'M'
+		{0x1FC0, 0x0400, 0x0200, 0x0100, 0x1FC0, 0x0000},	// 'N'
+		{0x0F80, 0x1040, 0x1040, 0x1040, 0x0F80, 0x0000},	// 'O'
+		{0x1FC0, 0x1200, 0x1200, 0x1200, 0x0C00, 0x0000},	// 'P'
+		{0x0F80, 0x1040, 0x1140, 0x1080, 0x0F40, 0x0000},	// 'Q'
+		{0x1FC0, 0x1200, 0x1300, 0x1280, 0x0C40, 0x0000},	// 'R'
+		{0x0C40, 0x1240, 0x1240, 0x1240, 0x1180, 0x0000},	// 'S'
+		{0x1000, 0x1000, 0x1FC0, 0x1000, 0x1000, 0x0000},	// 'T'
+		{0x1F80, 0x0040, 0x0040, 0x0040, 0x1F80, 0x0000},	// 'U'
+		{0x1F00, 0x0080, 0x0040, 0x0080, 0x1F00, 0x0000},	// 'V'
+		{0x1F80, 0x0040, 0x0380, 0x0040, 0x1F80, 0x0000},	// 'W'
+		{0x18C0, 0x0500, 0x0200, 0x0500, 0x18C0, 0x0000},	// 'X'
+		{0x1C00, 0x0200, 0x01C0, 0x0200, 0x1C00, 0x0000},	// 'Y'
+		{0x10C0, 0x1140, 0x1240, 0x1440, 0x1840, 0x0000},	// 'Z'
+		{0x0000, 0x1FC0, 0x1040, 0x1040, 0x0000, 0x0000},	// '['
+		{0x0800, 0x0400, 0x0200, 0x0100, 0x0080, 0x0000},	// backslash
+		{0x0000, 0x1040, 0x1040, 0x1FC0, 0x0000, 0x0000},	// ']'
+		{0x0400, 0x0800, 0x1000, 0x0800, 0x0400, 0x0000},	// '^'
+		{0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0000},	// '_'
+		{0x0000, 0x1000, 0x0800, 0x0400, 0x0000, 0x0000},	// '`'
+		{0x0080, 0x0540, 0x0540, 0x0540, 0x03C0, 0x0000},	// 'a'
+		{0x1FC0, 0x0240, 0x0440, 0x0440, 0x0380, 0x0000},	// 'b'
+		{0x0380, 0x0440, 0x0440, 0x0440, 0x0080, 0x0000},	// 'c'
+		{0x0380, 0x0440, 0x0440, 0x0240, 0x1FC0, 0x0000},	// 'd'
+		{0x0380, 0x0540, 0x0540, 0x0540, 0x0300, 0x0000},	// 'e'
+		{0x0200, 0x0FC0, 0x1200, 0x1000, 0x0800, 0x0000},	// 'f'
+		{0x0600, 0x0940, 0x0940, 0x0940, 0x0F80, 0x0000},	// 'g'
+		{0x1FC0, 0x0200, 0x0400, 0x0400, 0x03C0, 0x0000},	// 'h'
+		{0x0000, 0x0440, 0x17C0, 0x0040, 0x0000, 0x0000},	// 'i'
+		{0x0080, 0x0040, 0x0440, 0x1780, 0x0000, 0x0000},	// 'j'
+		{0x1FC0, 0x0100, 0x0280, 0x0440, 0x0000, 0x0000},	// 'k'
+		{0x0000, 0x1040, 0x1FC0, 0x0040, 0x0000, 0x0000},	// 'l'
+		{0x07C0, 0x0400, 0x0300, 0x0400, 0x03C0, 0x0000},	// 'm'
+		{0x07C0, 0x0200, 0x0400, 0x0400, 0x03C0, 0x0000},	// 'n'
+		{0x0380, 0x0440, 0x0440, 0x0440, 0x0380, 0x0000},	// 'o'
+		{0x07C0, 0x0500, 0x0500, 0x0500, 0x0200, 0x0000},	// 'p'
+		{0x0200, 0x0500, 0x0500, 0x0300, 0x07C0, 0x0000},	// 'q'
+		{0x07C0, 0x0200, 0x0400, 0x0400, 0x0200, 0x0000},	// 'r'
+		{0x0240, 0x0540, 0x0540, 0x0540, 0x0080, 0x0000},	// 's'
+		{0x0400, 0x1F80, 0x0440, 0x0040, 0x0080, 0x0000},	// 't'
+		{0x0780, 0x0040, 0x0040, 0x0080, 0x07C0, 0x0000},	// 'u'
+		{0x0700, 0x0080, 0x0040, 0x0080, 0x0700, 0x0000},	// 'v'
+		{0x0780, 0x0040, 0x0180, 0x0040, 0x0780, 0x0000},	// 'w'
+		{0x0440, 0x0280, 0x0100, 0x0280, 0x0440, 0x0000},	// 'x'
+		{0x0600, 0x0140, 0x0140, 0x0140, 0x0780, 0x0000},	// 'y'
+		{0x0440, 0x04C0, 0x0540, 0x0640, 0x0440, 0x0000},	// 'z'
+		{0x0000, 0x0200, 0x0D80, 0x1040, 0x0000, 0x0000},	// '{'
+		{0x0000, 0x0000, 0x1FC0, 0x0000, 0x0000, 0x0000},	// '|'
+		{0x0000, 0x1040, 0x0D80, 0x0200, 0x0000, 0x0000},	// '}'
+		{0x0800, 0x1000, 0x0800, 0x0400, 0x0800, 0x0000},	// '~'
+	},
+	{	// shifted right by 4
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// ' '
+		{0x0000, 0x0000, 0x0F20, 0x0000, 0x0000, 0x0000},	// '!'
+		{0x0000, 0x0E00, 0x0000, 0x0E00, 0x0000, 0x0000},	// '"'
+		{0x0280, 0x0FE0, 0x0280, 0x0FE0, 0x0280, 0x0000},	// '#'
+		{0x0240, 0x0540, 0x0FE0, 0x0540, 0x0480, 0x0000},	// '$'
+		{0x0C40, 0x0C80, 0x0100, 0x0260, 0x0460, 0x0000},	// '%'
+		{0x06C0, 0x0920, 0x0AA0, 0x0440, 0x00A0, 0x0000},	// '&'
+		{0x0000, 0x0A00, 0x0C00, 0x0000, 0x0000, 0x0000},	// '''
+		{0x0000, 0x0380, 0x0440, 0x0820, 0x0000, 0x0000},	// '('
+		{0x0000, 0x0820, 0x0440, 0x0380, 0x0000, 0x0000},	// ')'
+		{0x0280, 0x0100, 0x07C0, 0x0100, 0x0280, 0x0000},	// '*'
+		{0x0100, 0x0100, 0x07C0, 0x0100, 0x0100, 0x0000},	// '+'
+		{0x0000, 0x00A0, 0x00C0, 0x0000, 0x0000, 0x0000},	// ','
+		{0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0000},	// '-'
+		{0x0000, 0x0060, 0x0060, 0x0000, 0x0000, 0x0000},	// '.'
+		{0x0040, 0x0080, 0x0100, 0x0200, 0x0400, 0x0000},	// '/'
+		{0x07C0, 0x08A0, 0x0920, 0x0A20, 0x07C0, 0x0000},	// '0'
+		{0x0000, 0x0420, 0x0FE0, 0x0020, 0x0000, 0x0000},	// '1'
+		{0x0420, 0x0860, 0x08A0, 0x0920, 0x0620, 0x0000},	// '2'
+		{0x0840, 0x0820, 0x0A20, 0x0D20, 0x08C0, 0x0000},	// '3'
+		{0x0180, 0x0280, 0x0480, 0x0FE0, 0x0080, 0x0000},	// '4'
+		{0x0E40, 0x0A20, 0x0A20, 0x0A20, 0x09C0, 0x0000},	// '5'
+		{0x03C0, 0x0520, 0x0920, 0x0920, 0x00C0, 0x0000},	// '6'
+		{0x0800, 0x08E0, 0x0900, 0x0A00, 0x0C00, 0x0000},	// '7'
+		{0x06C0, 0x0920, 0x0920, 0x0920, 0x06C0, 0x0000},	// '8'
+		{0x0600, 0x0920, 0x0920, 0x0940, 0x0780, 0x0000},	// '9'
+		{0x0000, 0x06C0, 0x06C0, 0x0000, 0x0000, 0x0000},	// ':'
+		{0x0000, 0x06A0, 0x06C0, 0x0000, 0x0000, 0x0000},	// ';'
+		{0x0100, 0x0280, 0x0440, 0x0820, 0x0000, 0x0000},	// '<'
+		{0x0280, 0x0280, 0x0280, 0x0280, 0x0280, 0x0000},	// '='
+		{0x0000, 0x0820, 0x0440, 0x0280, 0x0100, 0x0000},	// '>'
+		{0x0400, 0x0800, 0x08A0, 0x0900, 0x0600, 0x0000},	// '?'
+		{0x04C0, 0x0920, 0x09E0, 0x0820, 0x07C0, 0x0000},	// '@'
+		{0x07E0, 0x0880, 0x0880, 0x0880, 0x07E0, 0x0000},	// 'A'
+		{0x0FE0, 0x0920, 0x0920, 0x0920, 0x06C0, 0x0000},	// 'B'
+		{0x07C0, 0x0820, 0x0820, 0x0820, 0x0440, 0x0000},	// 'C'
+		{0x0FE0, 0x0820, 0x0820, 0x0440, 0x0380, 0x0000},	// 'D'
+		{0x0FE0, 0x0920, 0x0920, 0x0920, 0x0820, 0x0000},	// 'E'
+		{0x0FE0, 0x0900, 0x0900, 0x0900, 0x0800, 0x0000},	// 'F'
+		{0x07C0, 0x0820, 0x0920, 0x0920, 0x05E0, 0x0000},	// 'G'
+		{0x0FE0, 0x0100, 0x0100, 0x0100, 0x0FE0, 0x0000},	// 'H'
+		{0x0000, 0x0820, 0x0FE0, 0x0820, 0x0000, 0x0000},	// 'I'
+		{0x0040, 0x0020, 0x0820, 0x0FC0, 0x0800, 0x0000},	// 'J'
+		{0x0FE0, 0x0100, 0x0280, 0x0440, 0x0820, 0x0000},	// 'K'
+		{0x0FE0, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000},	// 'L'
+		{0x0FE0, 0x0400, 0x0300, 0x0400, 0x0FE0, 0x0000},	// 'M'
+		{0x0FE0, 0x0200, 0x0100, 0x0080, 0x0FE0, 0x0000},	// 'N'
+		{0x07C0, 0x0820, 0x0820, 0x0820, 0x07C0, 0x0000},	// 'O'
+		{0x0FE0, 0x0900, 0x0900, 0x0900, 0x0600, 0x0000},	// 'P'
+		{0x07C0, 0x0820, 0x08A0, 0x0840, 0x07A0, 0x0000},	// 'Q'
+		{0x0FE0, 0x0900, 0x0980, 0x0940, 0x0620, 0x0000},	// 'R'
+		{0x0620, 0x0920, 0x0920, 0x0920, 0x08C0, 0x0000},	// 'S'
+		{0x0800, 0x0800, 0x0FE0, 0x0800, 0x0800, 0x0000},	// 'T'
+		{0x0FC0, 0x0020, 0x0020, 0x0020, 0x0FC0, 0x0000},	// 'U'
+		{0x0F80, 0x0040, 0x0020, 0x0040, 0x0F80, 0x0000},	// 'V'
+		{0x0FC0, 0x0020, 0x01C0, 0x0020, 0x0FC0, 0x0000},	// 'W'
+		{0x0C60, 0x0280, 0x0100, 0x0280, 0x0C60, 0x0000},	// 'X'
+		{0x0E00, 0x0100, 0x00E0, 0x0100, 0x0E00, 0x0000},	// 'Y'
+		{0x0860, 0x08A0, 0x0920, 0x0A20, 0x0C20, 0x0000},	// 'Z'
+		{0x0000, 0x0FE0, 0x0820, 0x0820, 0x0000, 0x0000},	// '['
+		{0x0400, 0x0200, 0x0100, 0x0080, 0x0040, 0x0000},	// backslash
+		{0x0000, 0x0820, 0x0820, 0x0FE0, 0x0000, 0x0000},	// ']'
+		{0x0200, 0x0400, 0x0800, 0x0400, 0x0200, 0x0000},	// '^'
+		{0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000},	// '_'
+		{0x0000, 0x0800, 0x0400, 0x0200, 0x0000, 0x0000},	// '`'
+		{0x0040, 0x02A0, 0x02A0, 0x02A0, 0x01E0, 0x0000},	// 'a'
+		{0x0FE0, 0x0120, 0x0220, 0x0220, 0x01C0, 0x0000},	// 'b'
+		{0x01C0, 0x0220, 0x0220, 0x0220, 0x0040, 0x0000},	// 'c'
+		{0x01C0, 0x0220, 0x0220, 0x0120, 0x0FE0, 0x0000},	// 'd'
+		{0x01C0, 0x02A0, 0x02A0, 0x02A0, 0x0180, 0x0000},	// 'e'
+		{0x0100, 0x07E0, 0x0900, 0x0800, 0x0400, 0x0000},	// 'f'
+		{0x0300, 0x04A0, 0x04A0, 0x04A0, 0x07C0, 0x0000},	// 'g'
+		{0x0FE0, 0x0100, 0x0200, 0x0200, 0x01E0, 0x0000},	// 'h'
+		{0x0000, 0x0220, 0x0BE0, 0x0020, 0x0000, 0x0000},	// 'i'
+		{0x0040, 0x0020, 0x0220, 0x0BC0, 0x0000, 0x0000},	// 'j'
+		{0x0FE0, 0x0080, 0x0140, 0x0220, 0x0000, 0x0000},	// 'k'
+		{0x0000, 0x0820, 0x0FE0, 0x0020, 0x0000, 0x0000},	// 'l'
+		{0x03E0, 0x0200, 0x0180, 0x0200, 0x01E0, 0x0000},	// 'm'
+		{0x03E0, 0x0100, 0x0200, 0x0200, 0x01E0, 0x0000},	// 'n'
+		{0x01C0, 0x0220, 0x0220, 0x0220, 0x01C0, 0x0000},	// 'o'
+		{0x03E0, 0x0280, 0x0280, 0x0280, 0x0100, 0x0000},	// 'p'
+		{0x0100, 0x0280, 0x0280, 0x0180, 0x03E0, 0x0000},	// 'q'
+		{0x03E0, 0x0100, 0x0200, 0x0200, 0x0100, 0x0000},	// 'r'
+		{0x0120, 0x02A0, 0x02A0, 0x02A0, 0x0040, 0x0000},	// 's'
+		{0x0200, 0x0FC0, 0x0220, 0x0020, 0x0040, 0x0000},	// 't'
+		{0x03C0, 0x0020, 0x0020, 0x0040, 0x03E0, 0x0000},	// 'u'
+		{0x0380, 0x0040, 0x0020, 0x0040, 0x0380, 0x0000},	// 'v'
+		{0x03C0, 0x0020, 0x00C0, 0x0020, 0x03C0, 0x0000},	// 'w'
+		{0x0220, 0x0140, 0x0080, 0x0140, 0x0220, 0x0000},	// 'x'
+		{0x0300, 0x00A0, 0x00A0, 0x00A0, 0x03C0, 0x0000},	// 'y'
+		{0x0220, 0x0260, 0x02A0, 0x0320, 0x0220, 0x0000},	// 'z'
+		{0x0000, 0x0100, 0x06C0, 0x0820, 0x0000, 0x0000},	// '{'
+		{0x0000, 0x0000, 0x0FE0, 0x0000, 0x0000, 0x0000},	// '|'
+		{0x0000, 0x0820, 0x06C0, 0x0100, 0x0000, 0x0000},	// '}'
+		{0x0400, 0x0800, 0x0400, 0x0200, 0x0400, 0x0000},	// '~'
+	},
+	{	// shifted right by 5
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// ' '
+		{0x0000, 0x0000, 0x0790, 0x0000, 0x0000, 0x0000},	// '!'
+		{0x0000, 0x0700, 0x0000, 0x0700, 0x0000, 0x0000},	// '"'
+		{0x0140, 0x07F0, 0x0140, 0x07F0, 0x0140, 0x0000},	// '#'
+		{0x0120, 0x02A0, 0x07F0, 0x02A0, 0x0240, 0x0000},	// '$'
+		{0x0620, 0x0640, 0x0080, 0x0130, 0x0230, 0x0000},	// '%'
+		{0x0360, 0x0490, 0x0550, 0x0220, 0x0050, 0x0000},	// '&'
+		{0x0000, 0x0500, 0x0600, 0x0000, 0x0000, 0x0000},	// '''
+		{0x0000, 0x01C0, 0x0220, 0x0410, 0x0000, 0x0000},	// '('
+		{0x0000, 0x0410, 0x0220, 0x01C0, 0x0000, 0x0000},	// ')'
+		{0x0140, 0x0080, 0x03E0, 0x0080, 0x0140, 0x0000},	// '*'
+		{0x0080, 0x0080, 0x03E0, 0x0080, 0x0080, 0x0000},	// '+'
+		{0x0000, 0x0050, 0x0060, 0x0000, 0x0000, 0x0000},	// ','
+		{0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0000},	// '-'
+		{0x0000, 0x0030, 0x0030, 0x0000, 0x0000, 0x0000},	// '.'
+		{0x0020, 0x0040, 0x0080, 0x0100, 0x0200, 0x0000},	// '/'
+		{0x03E0, 0x0450, 0x0490, 0x0510, 0x03E0, 0x0000},	// '0'
+		{0x0000, 0x0210, 0x07F0, 0x0010, 0x0000, 0x0000},	// '1'
+		{0x0210, 0x0430, 0x0450, 0x0490, 0x0310, 0x0000},	// '2'
+		{0x0420, 0x0410, 0x0510, 0x0690, 0x0460, 0x0000},	// '3'
+		{0x00C0, 0x0140, 0x0240, 0x07F0, 0x0040, 0x0000},	// '4'
+		{0x0720, 0x0510, 0x0510, 0x0510, 0x04E0, 0x0000},	// '5'
+		{0x01E0, 0x0290, 0x0490, 0x0490, 0x0060, 0x0000},	// '6'
+		{0x0400, 0x0470, 0x0480, 0x0500, 0x0600, 0x0000},	// '7'
+		{0x0360, 0x0490, 0x0490, 0x0490, 0x0360, 0x0000},	// '8'
+		{0x0300, 0x0490, 0x0490, 0x04A0, 0x03C0, 0x0000},	// '9'
+		{0x0000, 0x0360, 0x0360, 0x0000, 0x0000, 0x0000},	// ':'
+		{0x0000, 0x0350, 0x0360, 0x0000, 0x0000, 0x0000},	// ';'
+		{0x0080, 0x0140, 0x0220, 0x0410, 0x0000, 0x0000},	// '<'
+		{0x0140, 0x0140, 0x0140, 0x0140, 0x0140, 0x0000},	// '='
+		{0x0000, 0x0410, 0x0220, 0x0140, 0x0080, 0x0000},	// '>'
+		{0x0200, 0x0400, 0x0450, 0x0480, 0x0300, 0x0000},	// '?'
+		{0x0260, 0x0490, 0x04F0, 0x0410, 0x03E0, 0x0000},	// '@'
+		{0x03F0, 0x0440, 0x0440, 0x0440, 0x03F0, 0x0000},	// 'A'
+		{0x07F0, 0x0490, 0x0490, 0x0490, 0x0360, 0x0000},	// 'B'
+		{0x03E0, 0x0410, 0x0410, 0x0410, 0x0220, 0x0000},	// 'C'
+		{0x07F0, 0x0410, 0x0410, 0x0220, 0x01C0, 0x0000},	// 'D'
+		{0x07F0, 0x0490, 0x0490, 0x0490, 0x0410, 0x0000},	// 'E'
+		{0x07F0, 0x0480, 0x0480, 0x0480, 0x0400, 0x0000},	// 'F'
+		{0x03E0, 0x0410, 0x0490, 0x0490, 0x02F0, 0x0000},	// 'G'
+		{0x07F0, 0x0080, 0x0080, 0x0080, 0x07F0, 0x0000},	// 'H'
+		{0x0000, 0x0410, 0x07F0, 0x0410, 0x0000, 0x0000},	// 'I'
+		{0x0020, 0x0010, 0x0410, 0x07E0, 0x0400, 0x0000},	// 'J'
+		{0x07F0, 0x0080, 0x0140, 0x0220, 0x0410, 0x0000},	// 'K'
+		{0x07F0, 0x0010, 0x0010, 0x0010, 0x0010, 0x0000},	// 'L'
+		{0x07F0, 0x0200, 0x0180, 0x0200, 0x07F0, 0x0000},	// 'M'
+		{0x07F0, 0x0100, 0x0080, 0x0040, 0x07F0, 0x0000},	// 'N'
+		{0x03E0, 0x0410, 0x0410, 0x0410, 0x03E0, 0x0000},	// 'O'
+		{0x07F0, 0x0480, 0x0480, 0x0480, 0x0300, 0x0000},	// 'P'
+		{0x03E0, 0x0410, 0x0450, 0x0420, 0x03D0, 0x0000},	// 'Q'
+		{0x07F0, 0x0480, 0x04C0, 0x04A0, 0x0310, 0x0000},	// 'R'
+		{0x0310, 0x0490, 0x0490, 0x0490, 0x0460, 0x0000},	// 'S'
+		{0x0400, 0x0400, 0x07F0, 0x0400, 0x0400, 0x0000},	// 'T'
+		{0x07E0, 0x0010, 0x0010, 0x0010, 0x07E0, 0x0000},	// 'U'
+		{0x07C0, 0x0020, 0x0010, 0x0020, 0x07C0, 0x0000},	// 'V'
+		{0x07E0, 0x0010, 0x00E0, 0x0010, 0x07E0, 0x0000},	// 'W'
+		{0x0630, 0x0140, 0x0080, 0x0140, 0x0630, 0x0000},	// 'X'
+		{0x0700, 0x0080, 0x0070, 0x0080, 0x0700, 0x0000},	// 'Y'
+		{0x0430, 0x0450, 0x0490, 0x0510, 0x0610, 0x0000},	// 'Z'
+		{0x0000, 0x07F0, 0x0410, 0x0410, 0x0000, 0x0000},	// '['
+		{0x0200, 0x0100, 0x0080, 0x0040, 0x0020, 0x0000},	// backslash
+		{0x0000, 0x0410, 0x0410, 0x07F0, 0x0000, 0x0000},	// ']'
+		{0x0100, 0x0200, 0x0400, 0x0200, 0x0100, 0x0000},	// '^'
+		{0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0000},	// '_'
+		{0x0000, 0x0400, 0x0200, 0x0100, 0x0000, 0x0000},	// '`'
+		{0x0020, 0x0150, 0x0150, 0x0150, 0x00F0, 0x0000},	// 'a'
+		{0x07F0, 0x0090, 0x0110, 0x0110, 0x00E0, 0x0000},	// 'b'
+		{0x00E0, 0x0110, 0x0110, 0x0110, 0x0020, 0x0000},	// 'c'
+		{0x00E0, 0x0110, 0x0110, 0x0090, 0x07F0, 0x0000},	// 'd'
+		{0x00E0, 0x0150, 0x0150, 0x0150, 0x00C0, 0x0000},	// 'e'
+		{0x0080, 0x03F0, 0x0480, 0x0400, 0x0200, 0x0000},	// 'f'
+		{0x0180, 0x0250, 0x0250, 0x0250, 0x03E0, 0x0000},	// 'g'
+		{0x07F0, 0x0080, 0x0100, 0x0100, 0x00F0, 0x0000},	// 'h'
+		{0x0000, 0x0110, 0x05F0, 0x0010, 0x0000, 0x0000},	// 'i'
+		{0x0020, 0x0010, 0x0110, 0x05E0, 0x0000, 0x0000},	// 'j'
+		{0x07F0, 0x0040, 0x00A0, 0x0110, 0x0000, 0x0000},	// 'k'
+		{0x0000, 0x0410, 0x07F0, 0x0010, 0x0000, 0x0000},	// 'l'
+		{0x01F0, 0x0100, 0x00C0, 0x0100, 0x00F0, 0x0000},	// 'm'
+		{0x01F0, 0x0080, 0x0100, 0x0100, 0x00F0, 0x0000},	// 'n'
+		{0x00E0, 0x0110, 0x0110, 0x0110, 0x00E0, 0x0000},	// 'o'
+		{0x01F0, 0x0140, 0x0140, 0x0140, 0x0080, 0x0000},	// 'p'
+		{0x0080, 0x0140, 0x0140, 0x00C0, 0x01F0, 0x0000},	// 'q'
+		{0x01F0, 0x0080, 0x0100, 0x0100, 0x0080, 0x0000},	// 'r'
+		{0x0090, 0x0150, 0x0150, 0x0150, 0x0020, 0x0000},	// 's'
+		{0x0100, 0x07E0, 0x0110, 0x0010, 0x0020, 0x0000},	// 't'
+		{0x01E0, 0x0010, 0x0010, 0x0020, 0x01F0, 0x0000},	// 'u'
+		{0x01C0, 0x0020, 0x0010, 0x0020, 0x01C0, 0x0000},	// 'v'
+		{0x01E0, 0x0010, 0x0060, 0x0010, 0x01E0, 0x0000},	// 'w'
+		{0x0110, 0x00A0, 0x0040, 0x00A0, 0x0110, 0x0000},	// 'x'
+		{0x0180, 0x0050, 0x0050, 0x0050, 0x01E0, 0x0000},	// 'y'
+		{0x0110, 0x0130, 0x0150, 0x0190, 0x0110, 0x0000},	// 'z'
+		{0x0000, 0x0080, 0x0360, 0x0410, 0x0000, 0x0000},	// '{'
+		{0x0000, 0x0000, 0x07F0, 0x0000, 0x0000, 0x0000},	// '|'
+		{0x0000, 0x0410, 0x0360, 0x0080, 0x0000, 0x0000},	// '}'
+		{0x0200, 0x0400, 0x0200, 0x0100, 0x0200, 0x0000},	// '~'
+	},
+	{	// shifted right by 6
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// ' '
+		{0x0000, 0x0000, 0x03C8, 0x0000, 0x0000, 0x0000},	// '!'
+		{0x0000, 0x0380, 0x0000, 0x0380, 0x0000, 0x0000},	// '"'
+		{0x00A0, 0x03F8, 0x00A0, 0x03F8, 0x00A0, 0x0000},	// '#'
+		{0x0090, 0x0150, 0x03F8, 0x0150, 0x0120, 0x0000},	// '$'
+		{0x0310, 0x0320, 0x0040, 0x0098, 0x0118, 0x0000},	// '%'
+		{0x01B0, 0x0248, 0x02A8, 0x0110, 0x0028, 0x0000},	// '&'
+		{0x0000, 0x0280, 0x0300, 0x0000, 0x0000, 0x0000},	// '''
+		{0x0000, 0x00E0, 0x0110, 0x0208, 0x0000, 0x0000},	// '('
+		{0x0000, 0x0208, 0x0110, 0x00E0, 0x0000, 0x0000},	// ')'
+		{0x00A0, 0x0040, 0x01F0, 0x0040, 0x00A0, 0x0000},	// '*'
+		{0x0040, 0x0040, 0x01F0, 0x0040, 0x0040, 0x0000},	// '+'
+		{0x0000, 0x0028, 0x0030, 0x0000, 0x0000, 0x0000},	// ','
+		{0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0000},	// '-'
+		{0x0000, 0x0018, 0x0018, 0x0000, 0x0000, 0x0000},	// '.'
+		{0x0010, 0x0020, 0x0040, 0x0080, 0x0100, 0x0000},	// '/'
+		{0x01F0, 0x0228, 0x0248, 0x0288, 0x01F0, 0x0000},	// '0'
+		{0x0000, 0x0108, 0x03F8, 0x0008, 0x0000, 0x0000},	// '1'
+		{0x0108, 0x0218, 0x0228, 0x0248, 0x0188, 0x0000},	// '2'
+		{0x0210, 0x0208, 0x0288, 0x0348, 0x0230, 0x0000},	// '3'
+		{0x0060, 0x00A0, 0x0120, 0x03F8, 0x0020, 0x0000},	// '4'
+		{0x0390, 0x0288, 0x0288, 0x0288, 0x0270, 0x0000},	// '5'
+		{0x00F0, 0x0148, 0x0248, 0x0248, 0x0030, 0x0000},	// '6'
+		{0x0200, 0x0238, 0x0240, 0x0280, 0x0300, 0x0000},	// '7'
+		{0x01B0, 0x0248, 0x0248, 0x0248, 0x01B0, 0x0000},	// '8'
+		{0x0180, 0x0248, 0x0248, 0x0250, 0x01E0, 0x0000},	// '9'
+		{0x0000, 0x01B0, 0x01B0, 0x0000, 0x0000, 0x0000},	// ':'
+		{0x0000, 0x01A8, 0x01B0, 0x0000, 0x0000, 0x0000},	// ';'
+		{0x0040, 0x00A0, 0x0110, 0x0208, 0x0000, 0x0000},	// '<'
+		{0x00A0, 0x00A0, 0x00A0, 0x00A0, 0x00A0, 0x0000},	// '='
+		{0x0000, 0x0208, 0x0110, 0x00A0, 0x0040, 0x0000},	// '>'
+		{0x0100, 0x0200, 0x0228, 0x0240, 0x0180, 0x0000},	// '?'
+		{0x0130, 0x0248, 0x0278, 0x0208, 0x01F0, 0x0000},	// '@'
+		{0x01F8, 0x0220, 0x0220, 0x0220, 0x01F8, 0x0000},	// 'A'
+		{0x03F8, 0x0248, 0x0248, 0x0248, 0x01B0, 0x0000},	// 'B'
+		{0x01F0, 0x0208, 0x0208, 0x0208, 0x0110, 0x0000},	// 'C'
+		{0x03F8, 0x0208, 0x0208, 0x0110, 0x00E0, 0x0000},	// 'D'
+		{0x03F8, 0x0248, 0x0248, 0x0248, 0x0208, 0x0000},	// 'E'
+		{0x03F8, 0x0240, 0x0240, 0x0240, 0x0200, 0x0000},	// 'F'
+		{0x01F0, 0x0208, 0x0248, 0x0248, 0x0178, 0x0000},	// 'G'
+		{0x03F8, 0x0040, 0x0040, 0x0040, 0x03F8, 0x0000},	// 'H'
+		{0x0000, 0x0208, 0x03F8, 0x0208, 0x0000, 0x0000},	// 'I'
+		{0x0010, 0x0008, 0x0208, 0x03F0, 0x0200, 0x0000},	// 'J'
+		{0x03F8, 0x0040, 0x00A0, 0x0110, 0x0208, 0x0000},	// 'K'
+		{0x03F8, 0x0008, 0x0008, 0x0008, 0x0008, 0x0000},	// 'L'
+		{0x03F8, 0x0100, 0x00C0, 0x0100, 0x03F8, 0x0000},	// 'M'
+		{0x03F8, 0x0080, 0x0040, 0x0020, 0x03F8, 0x0000},	// 'N'
+		{0x01F0, 0x0208, 0x0208, 0x0208, 0x01F0, 0x0000},	// 'O'
+		{0x03F8, 0x0240, 0x0240, 0x0240, 0x0180, 0x0000},	// 'P'
+		{0x01F0, 0x0208, 0x0228, 0x0210, 0x01E8, 0x0000},	// 'Q'
+		{0x03F8, 0x0240, 0x0260, 0x0250, 0x0188, 0x0000},	// 'R'
+		{0x0188, 0x0248, 0x0248, 0x0248, 0x0230, 0x0000},	// 'S'
+		{0x0200, 0x0200, 0x03F8, 0x0200, 0x0200, 0x0000},	// 'T'
+		{0x03F0, 0x0008, 0x0008, 0x0008, 0x03F0, 0x0000},	// 'U'
+		{0x03E0, 0x0010, 0x0008, 0x0010, 0x03E0, 0x0000},	// 'V'
+		{0x03F0, 0x0008, 0x0070, 0x0008, 0x03F0, 0x0000},	// 'W'
+		{0x0318, 0x00A0, 0x0040, 0x00A0, 0x0318, 0x0000},	// 'X'
+		{0x0380, 0x0040, 0x0038, 0x0040, 0x0380, 0x0000},	// 'Y'
+		{0x0218, 0x0228, 0x0248, 0x0288, 0x0308, 0x0000},	// 'Z'
+		{0x0000, 0x03F8, 0x0208, 0x0208, 0x0000, 0x0000},	// '['
+		{0x0100, 0x0080, 0x0040, 0x0020, 0x0010, 0x0000},	// backslash
+		{0x0000, 0x0208, 0x0208, 0x03F8, 0x0000, 0x0000},	// ']'
+		{0x0080, 0x0100, 0x0200, 0x0100, 0x0080, 0x0000},	// '^'
+		{0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0000},	// '_'
+		{0x0000, 0x0200, 0x0100, 0x0080, 0x0000, 0x0000},	// '`'
+		{0x0010, 0x00A8, 0x00A8, 0x00A8, 0x0078, 0x0000},	// 'a'
+		{0x03F8, 0x0048, 0x0088, 0x0088, 0x0070, 0x0000},	// 'b'
+		{0x0070, 0x0088, 0x0088, 0x0088, 0x0010, 0x0000},	// 'c'
+		{0x0070, 0x0088, 0x0088, 0x0048, 0x03F8, 0x0000},	// 'd'
+		{0x0070, 0x00A8, 0x00A8, 0x00A8, 0x0060, 0x0000},	// 'e'
+		{0x0040, 0x01F8, 0x0240, 0x0200, 0x0100, 0x0000},	// 'f'
+		{0x00C0, 0x0128, 0x0128, 0x0128, 0x01F0, 0x0000},	// 'g'
+		{0x03F8, 0x0040, 0x0080, 0x0080, 0x0078, 0x0000},	// 'h'
+		{0x0000, 0x0088, 0x02F8, 0x0008, 0x0000, 0x0000},	// 'i'
+		{0x0010, 0x0008, 0x0088, 0x02F0, 0x0000, 0x0000},	// 'j'
+		{0x03F8, 0x0020, 0x0050, 0x0088, 0x0000, 0x0000},	// 'k'
+		{0x0000, 0x0208, 0x03F8, 0x0008, 0x0000, 0x0000},	// 'l'
+		{0x00F8, 0x0080, 0x0060, 0x0080, 0x0078, 0x0000},	// 'm'
+		{0x00F8, 0x0040, 0x0080, 0x0080, 0x0078, 0x0000},	// 'n'
+		{0x0070, 0x0088, 0x0088, 0x0088, 0x0070, 0x0000},	// 'o'
+		{0x00F8, 0x00A0, 0x00A0, 0x00A0, 0x0040, 0x0000},	// 'p'
+		{0x0040, 0x00A0, 0x00A0, 0x0060, 0x00F8, 0x0000},	// 'q'
+		{0x00F8, 0x0040, 0x0080, 0x0080, 0x0040, 0x0000},	// 'r'
+		{0x0048, 0x00A8, 0x00A8, 0x00A8, 0x0010, 0x0000},	// 's'
+		{0x0080, 0x03F0, 0x0088, 0x0008, 0x0010, 0x0000},	// 't'
+		{0x00F0, 0x0008, 0x0008, 0x0010, 0x00F8, 0x0000},	// 'u'
+		{0x00E0, 0x0010, 0x0008, 0x0010, 0x00E0, 0x0000},	// 'v'
+		{0x00F0, 0x0008, 0x0030, 0x0008, 0x00F0, 0x0000},	// 'w'
+		{0x0088, 0x0050, 0x0020, 0x0050, 0x0088, 0x0000},	// 'x'
+		{0x00C0, 0x0028, 0x0028, 0x0028, 0x00F0, 0x0000},	// 'y'
+		{0x0088, 0x0098, 0x00A8, 0x00C8, 0x0088, 0x0000},	// 'z'
+		{0x0000, 0x0040, 0x01B0, 0x0208, 0x0000, 0x0000},	// '{'
+		{0x0000, 0x0000, 0x03F8, 0x0000, 0x0000, 0x0000},	// '|'
+		{0x0000, 0x0208, 0x01B0, 0x0040, 0x0000, 0x0000},	// '}'
+		{0x0100, 0x0200, 0x0100, 0x0080, 0x0100, 0x0000},	// '~'
+	},
+	{	// shifted right by 7
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// ' '
+		{0x0000, 0x0000, 0x01E4, 0x0000, 0x0000, 0x0000},	// '!'
+		{0x0000, 0x01C0, 0x0000, 0x01C0, 0x0000, 0x0000},	// '"'
+		{0x0050, 0x01FC, 0x0050, 0x01FC, 0x0050, 0x0000},	// '#'
+		{0x0048, 0x00A8, 0x01FC, 0x00A8, 0x0090, 0x0000},	// '$'
+		{0x0188, 0x0190, 0x0020, 0x004C, 0x008C, 0x0000},	// '%'
+		{0x00D8, 0x0124, 0x0154, 0x0088, 0x0014, 0x0000},	// '&'
+		{0x0000, 0x0140, 0x0180, 0x0000, 0x0000, 0x0000},	// '''
+		{0x0000, 0x0070, 0x0088, 0x0104, 0x0000, 0x0000},	// '('
+		{0x0000, 0x0104, 0x0088, 0x0070, 0x0000, 0x0000},	// ')'
+		{0x0050, 0x0020, 0x00F8, 0x0020, 0x0050, 0x0000},	// '*'
+		{0x0020, 0x0020, 0x00F8, 0x0020, 0x0020, 0x0000},	// '+'
+		{0x0000, 0x0014, 0x0018, 0x0000, 0x0000, 0x0000},	// ','
+		{0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000},	// '-'
+		{0x0000, 0x000C, 0x000C, 0x0000, 0x0000, 0x0000},	// '.'
+		{0x0008, 0x0010, 0x0020, 0x0040, 0x0080, 0x0000},	// '/'
+		{0x00F8, 0x0114, 0x0124, 0x0144, 0x00F8, 0x0000},	// '0'
+		{0x0000, 0x0084, 0x01FC, 0x0004, 0x0000, 0x0000},	// '1'
+		{0x0084, 0x010C, 0x0114, 0x0124, 0x00C4, 0x0000},	// '2'
+		{0x0108, 0x0104, 0x0144, 0x01A4, 0x0118, 0x0000},	// '3'
+		{0x0030, 0x0050, 0x0090, 0x01FC, 0x0010, 0x0000},	// '4'
+		{0x01C8, 0x0144, 0x0144, 0x0144, 0x0138, 0x0000},	// '5'
+		{0x0078, 0x00A4, 0x0124, 0x0124, 0x0018, 0x0000},	// '6'
+		{0x0100, 0x011C, 0x0120, 0x0140, 0x0180, 0x0000},	// '7'
+		{0x00D8, 0x0124, 0x0124, 0x0124, 0x00D8, 0x0000},	// '8'
+		{0x00C0, 0x0124, 0x0124, 0x0128, 0x00F0, 0x0000},	// '9'
+		{0x0000, 0x00D8, 0x00D8, 0x0000, 0x0000, 0x0000},	// ':'
+		{0x0000, 0x00D4, 0x00D8, 0x0000, 0x0000, 0x0000},	// ';'
+		{0x0020, 0x0050, 0x0088, 0x0104, 0x0000, 0x0000},	// '<'
+		{0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0000},	// '='
+		{0x0000, 0x0104, 0x0088, 0x0050, 0x0020, 0x0000},	// '>'
+		{0x0080, 0x0100, 0x0114, 0x0120, 0x00C0, 0x0000},	// '?'
+		{0x0098, 0x0124, 0x013C, 0x0104, 0x00F8, 0x0000},	// '@'
+		{0x00FC, 0x0110, 0x0110, 0x0110, 0x00FC, 0x0000},	// 'A'
+		{0x01FC, 0x0124, 0x0124, 0x0124, 0x00D8, 0x0000},	// 'B'
+		{0x00F8, 0x0104, 0x0104, 0x0104, 0x0088, 0x0000},	// 'C'
+		{0x01FC, 0x0104, 0x0104, 0x0088, 0x0070, 0x0000},	// 'D'
+		{0x01FC, 0x0124, 0x0124, 0x0124, 0x0104, 0x0000},	// 'E'
+		{0x01FC, 0x0120, 0x0120, 0x0120, 0x0100, 0x0000},	// 'F'
+		{0x00F8, 0x0104, 0x0124, 0x0124, 0x00BC, 0x0000},	// 'G'
+		{0x01FC, 0x0020, 0x0020, 0x0020, 0x01FC, 0x0000},	// 'H'
+		{0x0000, 0x0104, 0x01FC, 0x0104, 0x0000, 0x0000},	// 'I'
+		{0x0008, 0x0004, 0x0104, 0x01F8, 0x0100, 0x0000},	// 'J'
+		{0x01FC, 0x0020, 0x0050, 0x0088, 0x0104, 0x0000},	// 'K'
+		{0x01FC, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000},	// 'L'
+		{0x01FC, 0x0080, 0x0060, 0x0080, 0x01FC, 0x0000},	// 'M'
+		{0x01FC, 0x0040, 0x0020, 0x0010, 0x01FC, 0x0000},	// 'N'
+		{0x00F8, 0x0104, 0x0104, 0x0104, 0x00F8, 0x0000},	// 'O'
+		{0x01FC, 0x0120, 0x0120, 0x0120, 0x00C0, 0x0000},	// 'P'
+		{0x00F8, 0x0104, 0x0114, 0x0108, 0x00F4, 0x0000},	// 'Q'
+		{0x01FC, 0x0120, 0x0130, 0x0128, 0x00C4, 0x0000},	// 'R'
+		{0x00C4, 0x0124, 0x0124, 0x0124, 0x0118, 0x0000},	// 'S'
+		{0x0100, 0x0100, 0x01FC, 0x0100, 0x0100, 0x0000},	// 'T'
+		{0x01F8, 0x0004, 0x0004, 0x0004, 0x01F8, 0x0000},	// 'U'
+		{0x01F0, 0x0008, 0x0004, 0x0008, 0x01F0, 0x0000},	// 'V'
+		{0x01F8, 0x0004, 0x0038, 0x0004, 0x01F8, 0x0000},	// 'W'
+		{0x018C, 0x0050, 0x0020, 0x0050, 0x018C, 0x0000},	// 'X'
+		{0x01C0, 0x0020, 0x001C, 0x0020, 0x01C0, 0x0000},	// 'Y'
+		{0x010C, 0x0114, 0x0124, 0x0144, 0x0184, 0x0000},	// 'Z'
+		{0x0000, 0x01FC, 0x0104, 0x0104, 0x0000, 0x0000},	// '['
+		{0x0080, 0x0040, 0x0020, 0x0010, 0x0008, 0x0000},	// backslash
+		{0x0000, 0x0104, 0x0104, 0x01FC, 0x0000, 0x0000},	// ']'
+		{0x0040, 0x0080, 0x0100, 0x0080, 0x0040, 0x0000},	// '^'
+		{0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000},	// '_'
+		{0x0000, 0x0100, 0x0080, 0x0040, 0x0000, 0x0000},	// '`'
+		{0x0008, 0x0054, 0x0054, 0x0054, 0x003C, 0x0000},	// 'a'
+		{0x01FC, 0x0024, 0x0044, 0x0044, 0x0038, 0x0000},	// 'b'
+		{0x0038, 0x0044, 0x0044, 0x0044, 0x0008, 0x0000},	// 'c'
+		{0x0038, 0x0044, 0x0044, 0x0024, 0x01FC, 0x0000},	// 'd'
+		{0x0038, 0x0054, 0x0054, 0x0054, 0x0030, 0x0000},	// 'e'
+		{0x0020, 0x00FC, 0x0120, 0x0100, 0x0080, 0x0000},	// 'f'
+		{0x0060, 0x0094, 0x0094, 0x0094, 0x00F8, 0x0000},	// 'g'
+		{0x01FC, 0x0020, 0x0040, 0x0040, 0x003C, 0x0000},	// 'h'
+		{0x0000, 0x0044, 0x017C, 0x0004, 0x0000, 0x0000},	// 'i'
+		{0x0008, 0x0004, 0x0044, 0x0178, 0x0000, 0x0000},	// 'j'
+		{0x01FC, 0x0010, 0x0028, 0x0044, 0x0000, 0x0000},	// 'k'
+		{0x0000, 0x0104, 0x01FC, 0x0004, 0x0000, 0x0000},	// 'l'
+		{0x007C, 0x0040, 0x0030, 0x0040, 0x003C, 0x0000},	// 'm'
+		{0x007C, 0x0020, 0x0040, 0x0040, 0x003C, 0x0000},	// 'n'
+		{0x0038, 0x0044, 0x0044, 0x0044, 0x0038, 0x0000},	// 'o'
+		{0x007C, 0x0050, 0x0050, 0x0050, 0x0020, 0x0000},	// 'p'
+		{0x0020, 0x0050, 0x0050, 0x0030, 0x007C, 0x0000},	// 'q'
+		{0x007C, 0x0020, 0x0040, 0x0040, 0x0020, 0x0000},	// 'r'
+		{0x0024, 0x0054, 0x0054, 0x0054, 0x0008, 0x0000},	// 's'
+		{0x0040, 0x01F8, 0x0044, 0x0004, 0x0008, 0x0000},	// 't'
+		{0x0078, 0x0004, 0x0004, 0x0008, 0x007C, 0x0000},	// 'u'
+		{0x0070, 0x0008, 0x0004, 0x0008, 0x0070, 0x0000},	// 'v'
+		{0x0078, 0x0004, 0x0018, 0x0004, 0x0078, 0x0000},	// 'w'
+		{0x0044, 0x0028, 0x0010, 0x0028, 0x0044, 0x0000},	// 'x'
+		{0x0060, 0x0014, 0x0014, 0x0014, 0x0078, 0x0000},	// 'y'
+		{0x0044, 0x004C, 0x0054, 0x0064, 0x0044, 0x0000},	// 'z'
+		{0x0000, 0x0020, 0x00D8, 0x0104, 0x0000, 0x0000},	// '{'
+		{0x0000, 0x0000, 0x01FC, 0x0000, 0x0000, 0x0000},	// '|'
+		{0x0000, 0x0104, 0x00D8, 0x0020, 0x0000, 0x0000},	// '}'
+		{0x0080, 0x0100, 0x0080, 0x0040, 0x0080, 0x0000},	// '~'
+	},
+#else
+	{	// shifted right by 0
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// ' '
+		{0x2000, 0x2000, 0x2000, 0x2000, 0x0000, 0x0000, 0x2000, 0x0000},	// '!'
+		{0x5000, 0x5000, 0x5000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '"'
+		{0x5000, 0x5000, 0xF800, 0x5000, 0xF800, 0x5000, 0x5000, 0x0000},	// '#'
+		{0x2000, 0x7800, 0xA000, 0x7000, 0x2800, 0xF000, 0x2000, 0x0000},	// '$'
+		{0xC000, 0xC800, 0x1000, 0x2000, 0x4000, 0x9800, 0x1800, 0x0000},	// '%'
+		{0x6000, 0x9000, 0xA000, 0x4000, 0xA800, 0x9000, 0x6800, 0x0000},	// '&'
+		{0x6000, 0x2000, 0x4000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '''
+		{0x1000, 0x2000, 0x4000, 0x4000, 0x4000, 0x2000, 0x1000, 0x0000},	// '('
+		{0x4000, 0x2000, 0x1000, 0x1000, 0x1000, 0x2000, 0x4000, 0x0000},	// ')'
+		{0x0000, 0x2000, 0xA800, 0x7000, 0xA800, 0x2000, 0x0000, 0x0000},	// '*'
+		{0x0000, 0x2000, 0x2000, 0xF800, 0x2000, 0x2000, 0x0000, 0x0000},	// '+'
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x6000, 0x2000, 0x4000, 0x0000},	// ','
+		{0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000},	// '-'
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6000, 0x6000, 0x0000},	// '.'
+		{0x0000, 0x0800, 0x1000, 0x2000, 0x4000, 0x8000, 0x0000, 0x0000},	// '/'
+		{0x7000, 0x8800, 0x9800, 0xA800, 0xC800, 0x8800, 0x7000, 0x0000},	// '0'
+		{0x2000, 0x6000, 0x2000, 0x2000, 0x2000, 0x2000, 0x7000, 0x0000},	// '1'
+		{0x7000, 0x8800, 0x0800, 0x1000, 0x2000, 0x4000, 0xF800, 0x0000},	// '2'
+		{0xF800, 0x1000, 0x2000, 0x1000, 0x0800, 0x8800, 0x7000, 0x0000},	// '3'
+		{0x1000, 0x3000, 0x5000, 0x9000, 0xF800, 0x1000, 0x1000, 0x0000},	// '4'
+		{0xF800, 0x8000, 0xF000, 0x0800, 0x0800, 0x8800, 0x7000, 0x0000},	// '5'
+		{0x3000, 0x4000, 0x8000, 0xF000, 0x8800, 0x8800, 0x7000, 0x0000},	// '6'
+		{0xF800, 0x0800, 0x1000, 0x2000, 0x4000, 0x4000, 0x4000, 0x0000},	// '7'
+		{0x7000, 0x8800, 0x8800, 0x7000, 0x8800, 0x8800, 0x7000, 0x0000},	// '8'
+		{0x7000, 0x8800, 0x8800, 0x7800, 0x0800, 0x1000, 0x6000, 0x0000},	// '9'
+		{0x0000, 0x6000, 0x6000, 0x0000, 0x6000, 0x6000, 0x0000, 0x0000},	// ':'
+		{0x0000, 0x6000, 0x6000, 0x0000, 0x6000, 0x2000, 0x4000, 0x0000},	// ';'
+		{0x1000, 0x2000, 0x4000, 0x8000, 0x4000, 0x2000, 0x1000, 0x0000},	// '<'
+		{0x0000, 0x0000, 0xF800, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000},	// '='
+		{0x4000, 0x2000, 0x1000, 0x0800, 0x1000, 0x2000, 0x4000, 0x0000},	// '>'
+		{0x7000, 0x8800, 0x0800, 0x1000, 0x2000, 0x0000, 0x2000, 0x0000},	// '?'
+		{0x7000, 0x8800, 0x0800, 0x6800, 0xA800, 0xA800, 0x7000, 0x0000},	// '@'
+		{0x7000, 0x8800, 0x8800, 0x8800, 0xF800, 0x8800, 0x8800, 0x0000},	// 'A'
+		{0xF000, 0x8800, 0x8800, 0xF000, 0x8800, 0x8800, 0xF000, 0x0000},	// 'B'
+		{0x7000, 0x8800, 0x8000, 0x8000, 0x8000, 0x8800, 0x7000, 0x0000},	// 'C'
+		{0xE000, 0x9000, 0x8800, 0x8800, 0x8800, 0x9000, 0xE000, 0x0000},	// 'D'
+		{0xF800, 0x8000, 0x8000, 0xF000, 0x8000, 0x8000, 0xF800, 0x0000},	// 'E'
+		{0xF800, 0x8000, 0x8000, 0xF000, 0x8000, 0x8000, 0x8000, 0x0000},	// 'F'
+		{0x7000, 0x8800, 0x8000, 0xB800, 0x8800, 0x8800, 0x7800, 0x0000},	// 'G'
+		{0x8800, 0x8800, 0x8800, 0xF800, 0x8800, 0x8800, 0x8800, 0x0000},	// 'H'
+		{0x7000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x7000, 0x0000},	// 'I'
+		{0x3800, 0x1000, 0x1000, 0x1000, 0x1000, 0x9000, 0x6000, 0x0000},	// 'J'
+		{0x8800, 0x9000, 0xA000, 0xC000, 0xA000, 0x9000, 0x8800, 0x0000},	// 'K'
+		{0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0xF800, 0x0000},	// 'L'
+		{0x8800, 0xD800, 0xA800, 0xA800, 0x8800, 0x8800, 0x8800, 0x0000},	// 'M'
+		{0x8800, 0x8800, 0xC800, 0xA800, 0x9800, 0x8800, 0x8800, 0x0000},	// 'N'
+		{0x7000, 0x8800, 0x8800, 0x8800, 0x8800, 0x8800, 0x7000, 0x0000},	// 'O'
+		{0xF000, 0x8800, 0x8800, 0xF000, 0x8000, 0x8000, 0x8000, 0x0000},	// 'P'
+		{0x7000, 0x8800, 0x8800, 0x8800, 0xA800, 0x9000, 0x6800, 0x0000},	// 'Q'
+		{0xF000, 0x8800, 0x8800, 0xF000, 0xA000, 0x9000, 0x8800, 0x0000},	// 'R'
+		{0x7800, 0x8000, 0x8000, 0x7000, 0x0800, 0x0800, 0xF000, 0x0000},	// 'S'
+		{0xF800, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x0000},	// 'T'
+		{0x8800, 0x8800, 0x8800, 0x8800, 0x8800, 0x8800, 0x7000, 0x0000},	// 'U'
+		{0x8800, 0x8800, 0x8800, 0x8800, 0x8800, 0x5000, 0x2000, 0x0000},	// 'V'
+		{0x8800, 0x8800, 0x8800, 0xA800, 0xA800, 0xA800, 0x5000, 0x0000},	// 'W'
+		{0x8800, 0x8800, 0x5000, 0x2000, 0x5000, 0x8800, 0x8800, 0x0000},	// 'X'
+		{0x8800, 0x8800, 0x8800, 0x5000, 0x2000, 0x2000, 0x2000, 0x0000},	// 'Y'
+		{0xF800, 0x0800, 0x1000, 0x2000, 0x4000, 0x8000, 0xF800, 0x0000},	// 'Z'
+		{0x7000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x7000, 0x0000},	// '['
+		{0x0000, 0x8000, 0x4000, 0x2000, 0x1000, 0x0800, 0x0000, 0x0000},	// backslash
+		{0x7000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x7000, 0x0000},	// ']'
+		{0x2000, 0x5000, 0x8800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '^'
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000},	// '_'
+		{0x4000, 0x2000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '`'
+		{0x0000, 0x0000, 0x7000, 0x0800, 0x7800, 0x8800, 0x7800, 0x0000},	// 'a'
+		{0x8000, 0x8000, 0xB000, 0xC800, 0x8800, 0x8800, 0xF000, 0x0000},	// 'b'
+		{0x0000, 0x0000, 0x7000, 0x8000, 0x8000, 0x8800, 0x7000, 0x0000},	// 'c'
+		{0x0800, 0x0800, 0x6800, 0x9800, 0x8800, 0x8800, 0x7800, 0x0000},	// 'd'
+		{0x0000, 0x0000, 0x7000, 0x8800, 0xF800, 0x8000, 0x7000, 0x0000},	// 'e'
+		{0x3000, 0x4800, 0x4000, 0xE000, 0x4000, 0x4000, 0x4000, 0x0000},	// 'f'
+		{0x0000, 0x7800, 0x8800, 0x8800, 0x7800, 0x0800, 0x7000, 0x0000},	// 'g'
+		{0x8000, 0x8000, 0xB000, 0xC800, 0x8800, 0x8800, 0x8800, 0x0000},	// 'h'
+		{0x2000, 0x0000, 0x6000, 0x2000, 0x2000, 0x2000, 0x7000, 0x0000},	// 'i'
+		{0x1000, 0x0000, 0x3000, 0x1000, 0x1000, 0x9000, 0x6000, 0x0000},	// 'j'
+		{0x8000, 0x8000, 0x9000, 0xA000, 0xC000, 0xA000, 0x9000, 0x0000},	// 'k'
+		{0x6000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x7000, 0x0000},	// 'l'
+		{0x0000, 0x0000, 0xD000, 0xA800, 0xA800, 0x8800, 0x8800, 0x0000},	// 'm'
+		{0x0000, 0x0000, 0xB000, 0xC800, 0x8800, 0x8800, 0x8800, 0x0000},	// 'n'
+		{0x0000, 0x0000, 0x7000, 0x8800, 0x8800, 0x8800, 0x7000, 0x0000},	// 'o'
+		{0x0000, 0x0000, 0xF000, 0x8800, 0xF000, 0x8000, 0x8000, 0x0000},	// 'p'
+		{0x0000, 0x0000, 0x6800, 0x9800, 0x7800, 0x0800, 0x0800, 0x0000},	// 'q'
+		{0x0000, 0x0000, 0xB000, 0xC800, 0x8000, 0x8000, 0x8000, 0x0000},	// 'r'
+		{0x0000, 0x0000, 0x7000, 0x8000, 0x7000, 0x0800, 0xF000, 0x0000},	// 's'
+		{0x4000, 0x4000, 0xE000, 0x4000, 0x4000, 0x4800, 0x3000, 0x0000},	// 't'
+		{0x0000, 0x0000, 0x8800, 0x8800, 0x8800, 0x9800, 0x6800, 0x0000},	// 'u'
+		{0x0000, 0x0000, 0x8800, 0x8800, 0x8800, 0x5000, 0x2000, 0x0000},	// 'v'
+		{0x0000, 0x0000, 0x8800, 0x8800, 0xA800, 0xA800, 0x5000, 0x0000},	// 'w'
+		{0x0000, 0x0000, 0x8800, 0x5000, 0x2000, 0x5000, 0x8800, 0x0000},	// 'x'
+		{0x0000, 0x0000, 0x8800, 0x8800, 0x7800, 0x0800, 0x7000, 0x0000},	// 'y'
+		{0x0000, 0x0000, 0xF800, 0x1000, 0x2000, 0x4000, 0xF800, 0x0000},	// 'z'
+		{0x1000, 0x2000, 0x2000, 0x4000, 0x2000, 0x2000, 0x1000, 0x0000},	// '{'
+		{0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x0000},	// '|'
+		{0x4000, 0x2000, 0x2000, 0x1000, 0x2000, 0x2000, 0x4000, 0x0000},	// '}'
+		{0x4000, 0xA800, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '~'
+	},
+	{	// shifted right by 1
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// ' '
+		{0x1000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0000, 0x1000, 0x0000},	// '!'
+		{0x2800, 0x2800, 0x2800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '"'
+		{0x2800, 0x2800, 0x7C00, 0x2800, 0x7C00, 0x2800, 0x2800, 0x0000},	// '#'
+		{0x1000, 0x3C00, 0x5000, 0x3800, 0x1400, 0x7800, 0x1000, 0x0000},	// '$'
+		{0x6000, 0x6400, 0x0800, 0x1000, 0x2000, 0x4C00, 0x0C00, 0x0000},	// '%'
+		{0x3000, 0x4800, 0x5000, 0x2000, 0x5400, 0x4800, 0x3400, 0x0000},	// '&'
+		{0x3000, 0x1000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '''
+		{0x0800, 0x1000, 0x2000, 0x2000, 0x2000, 0x1000, 0x0800, 0x0000},	// '('
+		{0x2000, 0x1000, 0x0800, 0x0800, 0x0800, 0x1000, 0x2000, 0x0000},	// ')'
+		{0x0000, 0x1000, 0x5400, 0x3800, 0x5400, 0x1000, 0x0000, 0x0000},	// '*'
+		{0x0000, 0x1000, 0x1000, 0x7C00, 0x1000, 0x1000, 0x0000, 0x0000},	// '+'
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x1000, 0x2000, 0x0000},	// ','
+		{0x0000, 0x0000, 0x0000, 0x7C00, 0x0000, 0x0000, 0x0000, 0x0000},	// '-'
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x3000, 0x0000},	// '.'
+		{0x0000, 0x0400, 0x0800, 0x1000, 0x2000, 0x4000, 0x0000, 0x0000},	// '/'
+		{0x3800, 0x4400, 0x4C00, 0x5400, 0x6400, 0x4400, 0x3800, 0x0000},	// '0'
+		{0x1000, 0x3000, 0x1000, 0x1000, 0x1000, 0x1000, 0x3800, 0x0000},	// '1'
+		{0x3800, 0x4400, 0x0400, 0x0800, 0x1000, 0x2000, 0x7C00, 0x0000},	// '2'
+		{0x7C00, 0x0800, 0x1000, 0x0800, 0x0400, 0x4400, 0x3800, 0x0000},	// '3'
+		{0x0800, 0x1800, 0x2800, 0x4800, 0x7C00, 0x0800, 0x0800, 0x0000},	// '4'
+		{0x7C00, 0x4000, 0x7800, 0x0400, 0x0400, 0x4400, 0x3800, 0x0000},	// '5'
+		{0x1800, 0x2000, 0x4000, 0x7800, 0x4400, 0x4400, 0x3800, 0x0000},	// '6'
+		{0x7C00, 0x0400, 0x0800, 0x1000, 0x2000, 0x2000, 0x2000, 0x0000},	// '7'
+		{0x3800, 0x4400, 0x4400, 0x3800, 0x4400, 0x4400, 0x3800, 0x0000},	// '8'
+		{0x3800, 0x4400, 0x4400, 0x3C00, 0x0400, 0x0800, 0x3000, 0x0000},	// '9'
+		{0x0000, 0x3000, 0x3000, 0x0000, 0x3000, 0x3000, 0x0000, 0x0000},	// ':'
+		{0x0000, 0x3000, 0x3000, 0x0000, 0x3000, 0x1000, 0x2000, 0x0000},	// ';'
+		{0x0800, 0x1000, 0x2000, 0x4000, 0x2000, 0x1000, 0x0800, 0x0000},	// '<'
+		{0x0000, 0x0000, 0x7C00, 0x0000, 0x7C00, 0x0000, 0x0000, 0x0000},	// '='
+		{0x2000, 0x1000, 0x0800, 0x0400, 0x0800, 0x1000, 0x2000, 0x0000},	// '>'
+		{0x3800, 0x4400, 0x0400, 0x0800, 0x1000, 0x0000, 0x1000, 0x0000},	// '?'
+		{0x3800, 0x4400, 0x0400, 0x3400, 0x5400, 0x5400, 0x3800, 0x0000},	// '@'
+		{0x3800, 0x4400, 0x4400, 0x4400, 0x7C00, 0x4400, 0x4400, 0x0000},	// 'A'
+		{0x7800, 0x4400, 0x4400, 0x7800, 0x4400, 0x4400, 0x7800, 0x0000},	// 'B'
+		{0x3800, 0x4400, 0x4000, 0x4000, 0x4000, 0x4400, 0x3800, 0x0000},	// 'C'
+		{0x7000, 0x4800, 0x4400, 0x4400, 0x4400, 0x4800, 0x7000, 0x0000},	// 'D'
+		{0x7C00, 0x4000, 0x4000, 0x7800, 0x4000, 0x4000, 0x7C00, 0x0000},	// 'E'
+		{0x7C00, 0x4000, 0x4000, 0x7800, 0x4000, 0x4000, 0x4000, 0x0000},	// 'F'
+		{0x3800, 0x4400, 0x4000, 0x5C00, 0x4400, 0x4400, 0x3C00, 0x0000},	// 'G'
+		{0x4400, 0x4400, 0x4400, 0x7C00, 0x4400, 0x4400, 0x4400, 0x0000},	// 'H'
+		{0x3800, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x3800, 0x0000},	// 'I'
+		{0x1C00, 0x0800, 0x0800, 0x0800, 0x0800, 0x4800, 0x3000, 0x0000},	// 'J'
+		{0x4400, 0x4800, 0x5000, 0x6000, 0x5000, 0x4800, 0x4400, 0x0000},	// 'K'
+		{0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x7C00, 0x0000},	// 'L'
+		{0x4400, 0x6C00, 0x5400, 0x5400, 0x4400, 0x4400, 0x4400, 0x0000},	// 'M'
+		{0x4400, 0x4400, 0x6400, 0x5400, 0x4C00, 0x4400, 0x4400, 0x0000},	// 'N'
+		{0x3800, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x3800, 0x0000},	// 'O'
+		{0x7800, 0x4400, 0x4400, 0x7800, 0x4000, 0x4000, 0x4000, 0x0000},	// 'P'
+		{0x3800, 0x4400, 0x4400, 0x4400, 0x5400, 0x4800, 0x3400, 0x0000},	// 'Q'
+		{0x7800, 0x4400, 0x4400, 0x7800, 0x5000, 0x4800, 0x4400, 0x0000},	// 'R'
+		{0x3C00, 0x4000, 0x4000, 0x3800, 0x0400, 0x0400, 0x7800, 0x0000},	// 'S'
+		{0x7C00, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x0000},	// 'T'
+		{0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x3800, 0x0000},	// 'U'
+		{0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x2800, 0x1000, 0x0000},	// 'V'
+		{0x4400, 0x4400, 0x4400, 0x5400, 0x5400, 0x5400, 0x2800, 0x0000},	// 'W'
+		{0x4400, 0x4400, 0x2800, 0x1000, 0x2800, 0x4400, 0x4400, 0x0000},	// 'X'
+		{0x4400, 0x4400, 0x4400, 0x2800, 0x1000, 0x1000, 0x1000, 0x0000},	// 'Y'
+		{0x7C00, 0x0400, 0x0800, 0x1000, 0x2000, 0x4000, 0x7C00, 0x0000},	// 'Z'
+		{0x3800, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x3800, 0x0000},	// '['
+		{0x0000, 0x4000, 0x2000, 0x1000, 0x0800, 0x0400, 0x0000, 0x0000},	// backslash
+		{0x3800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x3800, 0x0000},	// ']'
+		{0x1000, 0x2800, 0x4400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '^'
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7C00, 0x0000},	// '_'
+		{0x2000, 0x1000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '`'
+		{0x0000, 0x0000, 0x3800, 0x0400, 0x3C00, 0x4400, 0x3C00, 0x0000},	// 'a'
+		{0x4000, 0x4000, 0x5800, 0x6400, 0x4400, 0x4400, 0x7800, 0x0000},	// 'b'
+		{0x0000, 0x0000, 0x3800, 0x4000, 0x4000, 0x4400, 0x3800, 0x0000},	// 'c'
+		{0x0400, 0x0400, 0x3400, 0x4C00, 0x4400, 0x4400, 0x3C00, 0x0000},	// 'd'
+		{0x0000, 0x0000, 0x3800, 0x4400, 0x7C00, 0x4000, 0x3800, 0x0000},	// 'e'
+		{0x1800, 0x2400, 0x2000, 0x7000, 0x2000, 0x2000, 0x2000, 0x0000},	// 'f'
+		{0x0000, 0x3C00, 0x4400, 0x4400, 0x3C00, 0x0400, 0x3800, 0x0000},	// 'g'
+		{0x4000, 0x4000, 0x5800, 0x6400, 0x4400, 0x4400, 0x4400, 0x0000},	// 'h'
+		{0x1000, 0x0000, 0x3000, 0x1000, 0x1000, 0x1000, 0x3800, 0x0000},	// 'i'
+		{0x0800, 0x0000, 0x1800, 0x0800, 0x0800, 0x4800, 0x3000, 0x0000},	// 'j'
+		{0x4000, 0x4000, 0x4800, 0x5000, 0x6000, 0x5000, 0x4800, 0x0000},	// 'k'
+		{0x3000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x3800, 0x0000},	// 'l'
+		{0x0000, 0x0000, 0x6800, 0x5400, 0x5400, 0x4400, 0x4400, 0x0000},	// 'm'
+		{0x0000, 0x0000, 0x5800, 0x6400, 0x4400, 0x4400, 0x4400, 0x0000},	// 'n'
+		{0x0000, 0x0000, 0x3800, 0x4400, 0x4400, 0x4400, 0x3800, 0x0000},	// 'o'
+		{0x0000, 0x0000, 0x7800, 0x4400, 0x7800, 0x4000, 0x4000, 0x0000},	// 'p'
+		{0x0000, 0x0000, 0x3400, 0x4C00, 0x3C00, 0x0400, 0x0400, 0x0000},	// 'q'
+		{0x0000, 0x0000, 0x5800, 0x6400, 0x4000, 0x4000, 0x4000, 0x0000},	// 'r'
+		{0x0000, 0x0000, 0x3800, 0x4000, 0x3800, 0x0400, 0x7800, 0x0000},	// 's'
+		{0x2000, 0x2000, 0x7000, 0x2000, 0x2000, 0x2400, 0x1800, 0x0000},	// 't'
+		{0x0000, 0x0000, 0x4400, 0x4400, 0x4400, 0x4C00, 0x3400, 0x0000},	// 'u'
+		{0x0000, 0x0000, 0x4400, 0x4400, 0x4400, 0x2800, 0x1000, 0x0000},	// 'v'
+		{0x0000, 0x0000, 0x4400, 0x4400, 0x5400, 0x5400, 0x2800, 0x0000},	// 'w'
+		{0x0000, 0x0000, 0x4400, 0x2800, 0x1000, 0x2800, 0x4400, 0x0000},	// 'x'
+		{0x0000, 0x0000, 0x4400, 0x4400, 0x3C00, 0x0400, 0x3800, 0x0000},	// 'y'
+		{0x0000, 0x0000, 0x7C00, 0x0800, 0x1000, 0x2000, 0x7C00, 0x0000},	// 'z'
+		{0x0800, 0x1000, 0x1000, 0x2000, 0x1000, 0x1000, 0x0800, 0x0000},	// '{'
+		{0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x0000},	// '|'
+		{0x2000, 0x1000, 0x1000, 0x0800, 0x1000, 0x1000, 0x2000, 0x0000},	// '}'
+		{0x2000, 0x5400, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '~'
+	},
+	{	// shifted right by 2
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// ' '
+		{0x0800, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000},	// '!'
+		{0x1400, 0x1400, 0x1400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '"'
+		{0x1400, 0x1400, 0x3E00, 0x1400, 0x3E00, 0x1400, 0x1400, 0x0000},	// '#'
+		{0x0800, 0x1E00, 0x2800, 0x1C00, 0x0A00, 0x3C00, 0x0800, 0x0000},	// '$'
+		{0x3000, 0x3200, 0x0400, 0x0800, 0x1000, 0x2600, 0x0600, 0x0000},	// '%'
+		{0x1800, 0x2400, 0x2800, 0x1000, 0x2A00, 0x2400, 0x1A00, 0x0000},	// '&'
+		{0x1800, 0x0800, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '''
+		{0x0400, 0x0800, 0x1000, 0x1000, 0x1000, 0x0800, 0x0400, 0x0000},	// '('
+		{0x1000, 0x0800, 0x0400, 0x0400, 0x0400, 0x0800, 0x1000, 0x0000},	// ')'
+		{0x0000, 0x0800, 0x2A00, 0x1C00, 0x2A00, 0x0800, 0x0000, 0x0000},	// '*'
+		{0x0000, 0x0800, 0x0800, 0x3E00, 0x0800, 0x0800, 0x0000, 0x0000},	// '+'
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x1800, 0x0800, 0x1000, 0x0000},	// ','
+		{0x0000, 0x0000, 0x0000, 0x3E00, 0x0000, 0x0000, 0x0000, 0x0000},	// '-'
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1800, 0x1800, 0x0000},	// '.'
+		{0x0000, 0x0200, 0x0400, 0x0800, 0x1000, 0x2000, 0x0000, 0x0000},	// '/'
+		{0x1C00, 0x2200, 0x2600, 0x2A00, 0x3200, 0x2200, 0x1C00, 0x0000},	// '0'
+		{0x0800, 0x1800, 0x0800, 0x0800, 0x0800, 0x0800, 0x1C00, 0x0000},	// '1'
+		{0x1C00, 0x2200, 0x0200, 0x0400, 0x0800, 0x1000, 0x3E00, 0x0000},	// '2'
+		{0x3E00, 0x0400, 0x0800, 0x0400, 0x0200, 0x2200, 0x1C00, 0x0000},	// '3'
+		{0x0400, 0x0C00, 0x1400, 0x2400, 0x3E00, 0x0400, 0x0400, 0x0000},	// '4'
+		{0x3E00, 0x2000, 0x3C00, 0x0200, 0x0200, 0x2200, 0x1C00, 0x0000},	// '5'
+		{0x0C00, 0x1000, 0x2000, 0x3C00, 0x2200, 0x2200, 0x1C00, 0x0000},	// '6'
+		{0x3E00, 0x0200, 0x0400, 0x0800, 0x1000, 0x1000, 0x1000, 0x0000},	// '7'
+		{0x1C00, 0x2200, 0x2200, 0x1C00, 0x2200, 0x2200, 0x1C00, 0x0000},	// '8'
+		{0x1C00, 0x2200, 0x2200, 0x1E00, 0x0200, 0x0400, 0x1800, 0x0000},	// '9'
+		{0x0000, 0x1800, 0x1800, 0x0000, 0x1800, 0x1800, 0x0000, 0x0000},	// ':'
+		{0x0000, 0x1800, 0x1800, 0x0000, 0x1800, 0x0800, 0x1000, 0x0000},	// ';'
+		{0x0400, 0x0800, 0x1000, 0x2000, 0x1000, 0x0800, 0x0400, 0x0000},	// '<'
+		{0x0000, 0x0000, 0x3E00, 0x0000, 0x3E00, 0x0000, 0x0000, 0x0000},	// '='
+		{0x1000, 0x0800, 0x0400, 0x0200, 0x0400, 0x0800, 0x1000, 0x0000},	// '>'
+		{0x1C00, 0x2200, 0x0200, 0x0400, 0x0800, 0x0000, 0x0800, 0x0000},	// '?'
+		{0x1C00, 0x2200, 0x0200, 0x1A00, 0x2A00, 0x2A00, 0x1C00, 0x0000},	// '@'
+		{0x1C00, 0x2200, 0x2200, 0x2200, 0x3E00, 0x2200, 0x2200, 0x0000},	// 'A'
+		{0x3C00, 0x2200, 0x2200, 0x3C00, 0x2200, 0x2200, 0x3C00, 0x0000},	// 'B'
+		{0x1C00, 0x2200, 0x2000, 0x2000, 0x2000, 0x2200, 0x1C00, 0x0000},	// 'C'
+		{0x3800, 0x2400, 0x2200, 0x2200, 0x2200, 0x2400, 0x3800, 0x0000},	// 'D'
+		{0x3E00, 0x2000, 0x2000, 0x3C00, 0x2000, 0x2000, 0x3E00, 0x0000},	// 'E'
+		{0x3E00, 0x2000, 0x2000, 0x3C00, 0x2000, 0x2000, 0x2000, 0x0000},	// 'F'
+		{0x1C00, 0x2200, 0x2000, 0x2E00, 0x2200, 0x2200, 0x1E00, 0x0000},	// 'G'
+		{0x2200, 0x2200, 0x2200, 0x3E00, 0x2200, 0x2200, 0x2200, 0x0000},	// 'H'
+		{0x1C00, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x1C00, 0x0000},	// 'I'
+		{0x0E00, 0x0400, 0x0400, 0x0400, 0x0400, 0x2400, 0x1800, 0x0000},	// 'J'
+		{0x2200, 0x2400, 0x2800, 0x3000, 0x2800, 0x2400, 0x2200, 0x0000},	// 'K'
+		{0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x3E00, 0x0000},	// 'L'
+		{0x2200, 0x3600, 0x2A00, 0x2A00, 0x2200, 0x2200, 0x2200, 0x0000},	// 'M'
+		{0x2200, 0x2200, 0x3200, 0x2A00, 0x2600, 0x2200, 0x2200, 0x0000},	// 'N'
+		{0x1C00, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x1C00, 0x0000},	// 'O'
+		{0x3C00, 0x2200, 0x2200, 0x3C00, 0x2000, 0x2000, 0x2000, 0x0000},	// 'P'
+		{0x1C00, 0x2200, 0x2200, 0x2200, 0x2A00, 0x2400, 0x1A00, 0x0000},	// 'Q'
+		{0x3C00, 0x2200, 0x2200, 0x3C00, 0x2800, 0x2400, 0x2200, 0x0000},	// 'R'
+		{0x1E00, 0x2000, 0x2000, 0x1C00, 0x0200, 0x0200, 0x3C00, 0x0000},	// 'S'
+		{0x3E00, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0000},	// 'T'
+		{0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x1C00, 0x0000},	// 'U'
+		{0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x1400, 0x0800, 0x0000},	// 'V'
+		{0x2200, 0x2200, 0x2200, 0x2A00, 0x2A00, 0x2A00, 0x1400, 0x0000},	// 'W'
+		{0x2200, 0x2200, 0x1400, 0x0800, 0x1400, 0x2200, 0x2200, 0x0000},	// 'X'
+		{0x2200, 0x2200, 0x2200, 0x1400, 0x0800, 0x0800, 0x0800, 0x0000},	// 'Y'
+		{0x3E00, 0x0200, 0x0400, 0x0800, 0x1000, 0x2000, 0x3E00, 0x0000},	// 'Z'
+		{0x1C00, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1C00, 0x0000},	// '['
+		{0x0000, 0x2000, 0x1000, 0x0800, 0x0400, 0x0200, 0x0000, 0x0000},	// backslash
+		{0x1C00, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x1C00, 0x0000},	// ']'
+		{0x0800, 0x1400, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '^'
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3E00, 0x0000},	// '_'
+		{0x1000, 0x0800, 0x0400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '`'
+		{0x0000, 0x0000, 0x1C00, 0x0200, 0x1E00, 0x2200, 0x1E00, 0x0000},	// 'a'
+		{0x2000, 0x2000, 0x2C00, 0x3200, 0x2200, 0x2200, 0x3C00, 0x0000},	// 'b'
+		{0x0000, 0x0000, 0x1C00, 0x2000, 0x2000, 0x2200, 0x1C00, 0x0000},	// 'c'
+		{0x0200, 0x0200, 0x1A00, 0x2600, 0x2200, 0x2200, 0x1E00, 0x0000},	// 'd'
+		{0x0000, 0x0000, 0x1C00, 0x2200, 0x3E00, 0x2000, 0x1C00, 0x0000},	// 'e'
+		{0x0C00, 0x1200, 0x1000, 0x3800, 0x1000, 0x1000, 0x1000, 0x0000},	// 'f'
+		{0x0000, 0x1E00, 0x2200, 0x2200, 0x1E00, 0x0200, 0x1C00, 0x0000},	// 'g'
+		{0x2000, 0x2000, 0x2C00, 0x3200, 0x2200, 0x2200, 0x2200, 0x0000},	// 'h'
+		{0x0800, 0x0000, 0x1800, 0x0800, 0x0800, 0x0800, 0x1C00, 0x0000},	// 'i'
+		{0x0400, 0x0000, 0x0C00, 0x0400, 0x0400, 0x2400, 0x1800, 0x0000},	// 'j'
+		{0x2000, 0x2000, 0x2400, 0x2800, 0x3000, 0x2800, 0x2400, 0x0000},	// 'k'
+		{0x1800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x1C00, 0x0000},	// 'l'
+		{0x0000, 0x0000, 0x3400, 0x2A00, 0x2A00, 0x2200, 0x2200, 0x0000},	// 'm'
+		{0x0000, 0x0000, 0x2C00, 0x3200, 0x2200, 0x2200, 0x2200, 0x0000},	// 'n'
+		{0x0000, 0x0000, 0x1C00, 0x2200, 0x2200, 0x2200, 0x1C00, 0x0000},	// 'o'
+		{0x0000, 0x0000, 0x3C00, 0x2200, 0x3C00, 0x2000, 0x2000, 0x0000},	// 'p'
+		{0x0000, 0x0000, 0x1A00, 0x2600, 0x1E00, 0x0200, 0x0200, 0x0000},	// 'q'
+		{0x0000, 0x0000, 0x2C00, 0x3200, 0x2000, 0x2000, 0x2000, 0x0000},	// 'r'
+		{0x0000, 0x0000, 0x1C00, 0x2000, 0x1C00, 0x0200, 0x3C00, 0x0000},	// 's'
+		{0x1000, 0x1000, 0x3800, 0x1000, 0x1000, 0x1200, 0x0C00, 0x0000},	// 't'
+		{0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x2600, 0x1A00, 0x0000},	// 'u'
+		{0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x1400, 0x0800, 0x0000},	// 'v'
+		{0x0000, 0x0000, 0x2200, 0x2200, 0x2A00, 0x2A00, 0x1400, 0x0000},	// 'w'
+		{0x0000, 0x0000, 0x2200, 0x1400, 0x0800, 0x1400, 0x2200, 0x0000},	// 'x'
+		{0x0000, 0x0000, 0x2200, 0x2200, 0x1E00, 0x0200, 0x1C00, 0x0000},	// 'y'
+		{0x0000, 0x0000, 0x3E00, 0x0400, 0x0800, 0x1000, 0x3E00, 0x0000},	// 'z'
+		{0x0400, 0x0800, 0x0800, 0x1000, 0x0800, 0x0800, 0x0400, 0x0000},	// '{'
+		{0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0000},	// '|'
+		{0x1000, 0x0800, 0x0800, 0x0400, 0x0800, 0x0800, 0x1000, 0x0000},	// '}'
+		{0x1000, 0x2A00, 0x0400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '~'
+	},
+	{	// shifted right by 3
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// ' '
+		{0x0400, 0x0400, 0x0400, 0x0400, 0x0000, 0x0000, 0x0400, 0x0000},	// '!'
+		{0x0A00, 0x0A00, 0x0A00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '"'
+		{0x0A00, 0x0A00, 0x1F00, 0x0A00, 0x1F00, 0x0A00, 0x0A00, 0x0000},	// '#'
+		{0x0400, 0x0F00, 0x1400, 0x0E00, 0x0500, 0x1E00, 0x0400, 0x0000},	// '$'
+		{0x1800, 0x1900, 0x0200, 0x0400, 0x0800, 0x1300, 0x0300, 0x0000},	// '%'
+		{0x0C00, 0x1200, 0x1400, 0x0800, 0x1500, 0x1200, 0x0D00, 0x0000},	// '&'
+		{0x0C00, 0x0400, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '''
+		{0x0200, 0x0400, 0x0800, 0x0800, 0x0800, 0x0400, 0x0200, 0x0000},	// '('
+		{0x0800, 0x0400, 0x0200, 0x0200, 0x0200, 0x0400, 0x0800, 0x0000},	// ')'
+		{0x0000, 0x0400, 0x1500, 0x0E00, 0x1500, 0x0400, 0x0000, 0x0000},	// '*'
+		{0x0000, 0x0400, 0x0400, 0x1F00, 0x0400, 0x0400, 0x0000, 0x0000},	// '+'
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0C00, 0x0400, 0x0800, 0x0000},	// ','
+		{0x0000, 0x0000, 0x0000, 0x1F00, 0x0000, 0x0000, 0x0000, 0x0000},	// '-'
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0C00, 0x0C00, 0x0000},	// '.'
+		{0x0000, 0x0100, 0x0200, 0x0400, 0x0800, 0x1000, 0x0000, 0x0000},	// '/'
+		{0x0E00, 0x1100, 0x1300, 0x1500, 0x1900, 0x1100, 0x0E00, 0x0000},	// '0'
+		{0x0400, 0x0C00, 0x0400, 0x0400, 0x0400, 0x0400, 0x0E00, 0x0000},	// '1'
+		{0x0E00, 0x1100, 0x0100, 0x0200, 0x0400, 0x0800, 0x1F00, 0x0000},	// '2'
+		{0x1F00, 0x0200, 0x0400, 0x0200, 0x0100, 0x1100, 0x0E00, 0x0000},	// '3'
+		{0x0200, 0x0600, 0x0A00, 0x1200, 0x1F00, 0x0200, 0x0200, 0x0000},	// '4'
+		{0x1F00, 0x1000, 0x1E00, 0x0100, 0x0100, 0x1100, 0x0E00, 0x0000},	// '5'
+		{0x0600, 0x0800, 0x1000, 0x1E00, 0x1100, 0x1100, 0x0E00, 0x0000},	// '6'
+		{0x1F00, 0x0100, 0x0200, 0x0400, 0x0800, 0x0800, 0x0800, 0x0000},	// '7'
+		{0x0E00, 0x1100, 0x1100, 0x0E00, 0x1100, 0x1100, 0x0E00, 0x0000},	// '8'
+		{0x0E00, 0x1100, 0x1100, 0x0F00, 0x0100, 0x0200, 0x0C00, 0x0000},	// '9'
+		{0x0000, 0x0C00, 0x0C00, 0x0000, 0x0C00, 0x0C00, 0x0000, 0x0000},	// ':'
+		{0x0000, 0x0C00, 0x0C00, 0x0000, 0x0C00, 0x0400, 0x0800, 0x0000},	// ';'
+		{0x0200, 0x0400, 0x0800, 0x1000, 0x0800, 0x0400, 0x0200, 0x0000},	// '<'
+		{0x0000, 0x0000, 0x1F00, 0x0000, 0x1F00, 0x0000, 0x0000, 0x0000},	// '='
+		{0x0800, 0x0400, 0x0200, 0x0100, 0x0200, 0x0400, 0x0800, 0x0000},	// '>'
+		{0x0E00, 0x1100, 0x0100, 0x0200, 0x0400, 0x0000, 0x0400, 0x0000},	// '?'
+		{0x0E00, 0x1100, 0x0100, 0x0D00, 0x1500, 0x1500, 0x0E00, 0x0000},	// '@'
+		{0x0E00, 0x1100, 0x1100, 0x1100, 0x1F00, 0x1100, 0x1100, 0x0000},	// 'A'
+		{0x1E00, 0x1100, 0x1100, 0x1E00, 0x1100, 0x1100, 0x1E00, 0x0000},	// 'B'
+		{0x0E00, 0x1100, 0x1000, 0x1000, 0x1000, 0x1100, 0x0E00, 0x0000},	// 'C'
+		{0x1C00, 0x1200, 0x1100, 0x1100, 0x1100, 0x1200, 0x1C00, 0x0000},	// 'D'
+		{0x1F00, 0x1000, 0x1000, 0x1E00, 0x1000, 0x1000, 0x1F00, 0x0000},	// 'E'
+		{0x1F00, 0x1000, 0x1000, 0x1E00, 0x1000, 0x1000, 0x1000, 0x0000},	// 'F'
+		{0x0E00, 0x1100, 0x1000, 0x1700, 0x1100, 0x1100, 0x0F00, 0x0000},	// 'G'
+		{0x1100, 0x1100, 0x1100, 0x1F00, 0x1100, 0x1100, 0x1100, 0x0000},	// 'H'
+		{0x0E00, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0E00, 0x0000},	// 'I'
+		{0x0700, 0x0200, 0x0200, 0x0200, 0x0200, 0x1200, 0x0C00, 0x0000},	// 'J'
+		{0x1100, 0x1200, 0x1400, 0x1800, 0x1400, 0x1200, 0x1100, 0x0000},	// 'K'
+		{0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1F00, 0x0000},	// 'L'
+		{0x1100, 0x1B00, 0x1500, 0x1500, 0x1100, 0x1100, 0x1100, 0x0000},	// 'M'
+		{0x1100, 0x1100, 0x1900, 0x1500, 0x1300, 0x1100, 0x1100, 0x0000},	// 'N'
+		{0x0E00, 0x1100, 0x1100, 0x1100, 0x1100, 0x1100, 0x0E00, 0x0000},	// 'O'
+		{0x1E00, 0x1100, 0x1100, 0x1E00, 0x1000, 0x1000, 0x1000, 0x0000},	// 'P'
+		{0x0E00, 0x1100, 0x1100, 0x1100, 0x1500, 0x1200, 0x0D00, 0x0000},	// 'Q'
+		{0x1E00, 0x1100, 0x1100, 0x1E00, 0x1400, 0x1200, 0x1100, 0x0000},	// 'R'
+		{0x0F00, 0x1000, 0x1000, 0x0E00, 0x0100, 0x0100, 0x1E00, 0x0000},	// 'S'
+		{0x1F00, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0000},	// 'T'
+		{0x1100, 0x1100, 0x1100, 0x1100, 0x1100, 0x1100, 0x0E00, 0x0000},	// 'U'
+		{0x1100, 0x1100, 0x1100, 0x1100, 0x1100, 0x0A00, 0x0400, 0x0000},	// 'V'
+		{0x1100, 0x1100, 0x1100, 0x1500, 0x1500, 0x1500, 0x0A00, 0x0000},	// 'W'
+		{0x1100, 0x1100, 0x0A00, 0x0400, 0x0A00, 0x1100, 0x1100, 0x0000},	// 'X'
+		{0x1100, 0x1100, 0x1100, 0x0A00, 0x0400, 0x0400, 0x0400, 0x0000},	// 'Y'
+		{0x1F00, 0x0100, 0x0200, 0x0400, 0x0800, 0x1000, 0x1F00, 0x0000},	// 'Z'
+		{0x0E00, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0E00, 0x0000},	// '['
+		{0x0000, 0x1000, 0x0800, 0x0400, 0x0200, 0x0100, 0x0000, 0x0000},	// backslash
+		{0x0E00, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0E00, 0x0000},	// ']'
+		{0x0400, 0x0A00, 0x1100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '^'
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F00, 0x0000},	// '_'
+		{0x0800, 0x0400, 0x0200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '`'
+		{0x0000, 0x0000, 0x0E00, 0x0100, 0x0F00, 0x1100, 0x0F00, 0x0000},	// 'a'
+		{0x1000, 0x1000, 0x1600, 0x1900, 0x1100, 0x1100, 0x1E00, 0x0000},	// 'b'
+		{0x0000, 0x0000, 0x0E00, 0x1000, 0x1000, 0x1100, 0x0E00, 0x0000},	// 'c'
+		{0x0100, 0x0100, 0x0D00, 0x1300, 0x1100, 0x1100, 0x0F00, 0x0000},	// 'd'
+		{0x0000, 0x0000, 0x0E00, 0x1100, 0x1F00, 0x1000, 0x0E00, 0x0000},	// 'e'
+		{0x0600, 0x0900, 0x0800, 0x1C00, 0x0800, 0x0800, 0x0800, 0x0000},	// 'f'
+		{0x0000, 0x0F00, 0x1100, 0x1100, 0x0F00, 0x0100, 0x0E00, 0x0000},	// 'g'
+		{0x1000, 0x1000, 0x1600, 0x1900, 0x1100, 0x1100, 0x1100, 0x0000},	// 'h'
+		{0x0400, 0x0000, 0x0C00, 0x0400, 0x0400, 0x0400, 0x0E00, 0x0000},	// 'i'
+		{0x0200, 0x0000, 0x0600, 0x0200, 0x0200, 0x1200, 0x0C00, 0x0000},	// 'j'
+		{0x1000, 0x1000, 0x1200, 0x1400, 0x1800, 0x1400, 0x1200, 0x0000},	// 'k'
+		{0x0C00, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0E00, 0x0000},	// 'l'
+		{0x0000, 0x0000, 0x1A00, 0x1500, 0x1500, 0x1100, 0x1100, 0x0000},	// 'm'
+		{0x0000, 0x0000, 0x1600, 0x1900, 0x1100, 0x1100, 0x1100, 0x0000},	// 'n'
+		{0x0000, 0x0000, 0x0E00, 0x1100, 0x1100, 0x1100, 0x0E00, 0x0000},	// 'o'
+		{0x0000, 0x0000, 0x1E00, 0x1100, 0x1E00, 0x1000, 0x1000, 0x0000},	// 'p'
+		{0x0000, 0x0000, 0x0D00, 0x1300, 0x0F00, 0x0100, 0x0100, 0x0000},	// 'q'
+		{0x0000, 0x0000, 0x1600, 0x1900, 0x1000, 0x1000, 0x1000, 0x0000},	// 'r'
+		{0x0000, 0x0000, 0x0E00, 0x1000, 0x0E00, 0x0100, 0x1E00, 0x0000},	// 's'
+		{0x0800, 0x0800, 0x1C00, 0x0800, 0x0800, 0x0900, 0x0600, 0x0000},	// 't'
+		{0x0000, 0x0000, 0x1100, 0x1100, 0x1100, 0x1300, 0x0D00, 0x0000},	// 'u'
+		{0x0000, 0x0000, 0x1100, 0x1100, 0x1100, 0x0A00, 0x0400, 0x0000},	// 'v'
+		{0x0000, 0x0000, 0x1100, 0x1100, 0x1500, 0x1500, 0x0A00, 0x0000},	// 'w'
+		{0x0000, 0x0000, 0x1100, 0x0A00, 0x0400, 0x0A00, 0x1100, 0x0000},	// 'x'
+		{0x0000, 0x0000, 0x1100, 0x1100, 0x0F00, 0x0100, 0x0E00, 0x0000},	// 'y'
+		{0x0000, 0x0000, 0x1F00, 0x0200, 0x0400, 0x0800, 0x1F00, 0x0000},	// 'z'
+		{0x0200, 0x0400, 0x0400, 0x0800, 0x0400, 0x0400, 0x0200, 0x0000},	// '{'
+		{0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0000},	// '|'
+		{0x0800, 0x0400, 0x0400, 0x0200, 0x0400, 0x0400, 0x0800, 0x0000},	// '}'
+		{0x0800, 0x1500, 0x0200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '~'
+	},
+	{	// shifted right by 4
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// ' '
+		{0x0200, 0x0200, 0x0200, 0x0200, 0x0000, 0x0000, 0x0200, 0x0000},	// '!'
+		{0x0500, 0x0500, 0x0500, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '"'
+		{0x0500, 0x0500, 0x0F80, 0x0500, 0x0F80, 0x0500, 0x0500, 0x0000},	// '#'
+		{0x0200, 0x0780, 0x0A00, 0x0700, 0x0280, 0x0F00, 0x0200, 0x0000},	// '$'
+		{0x0C00, 0x0C80, 0x0100, 0x0200, 0x0400, 0x0980, 0x0180, 0x0000},	// '%'
+		{0x0600, 0x0900, 0x0A00, 0x0400, 0x0A80, 0x0900, 0x0680, 0x0000},	// '&'
+		{0x0600, 0x0200, 0x0400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '''
+		{0x0100, 0x0200, 0x0400, 0x0400, 0x0400, 0x0200, 0x0100, 0x0000},	// '('
+		{0x0400, 0x0200, 0x0100, 0x0100, 0x0100, 0x0200, 0x0400, 0x0000},	// ')'
+		{0x0000, 0x0200, 0x0A80, 0x0700, 0x0A80, 0x0200, 0x0000, 0x0000},	// '*'
+		{0x0000, 0x0200, 0x0200, 0x0F80, 0x0200, 0x0200, 0x0000, 0x0000},	// '+'
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0600, 0x0200, 0x0400, 0x0000},	// ','
+		{0x0000, 0x0000, 0x0000, 0x0F80, 0x0000, 0x0000, 0x0000, 0x0000},	// '-'
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0600, 0x0600, 0x0000},	// '.'
+		{0x0000, 0x0080, 0x0100, 0x0200, 0x0400, 0x0800, 0x0000, 0x0000},	// '/'
+		{0x0700, 0x0880, 0x0980, 0x0A80, 0x0C80, 0x0880, 0x0700, 0x0000},	// '0'
+		{0x0200, 0x0600, 0x0200, 0x0200, 0x0200, 0x0200, 0x0700, 0x0000},	// '1'
+		{0x0700, 0x0880, 0x0080, 0x0100, 0x0200, 0x0400, 0x0F80, 0x0000},	// '2'
+		{0x0F80, 0x0100, 0x0200, 0x0100, 0x0080, 0x0880, 0x0700, 0x0000},	// '3'
+		{0x0100, 0x0300, 0x0500, 0x0900, 0x0F80, 0x0100, 0x0100, 0x0000},	// '4'
+		{0x0F80, 0x0800, 0x0F00, 0x0080, 0x0080, 0x0880, 0x0700, 0x0000},	// '5'
+		{0x0300, 0x0400, 0x0800, 0x0F00, 0x0880, 0x0880, 0x0700, 0x0000},	// '6'
+		{0x0F80, 0x0080, 0x0100, 0x0200, 0x0400, 0x0400, 0x0400, 0x0000},	// '7'
+		{0x0700, 0x0880, 0x0880, 0x0700, 0x0880, 0x0880, 0x0700, 0x0000},	// '8'
+		{0x0700, 0x0880, 0x0880, 0x0780, 0x0080, 0x0100, 0x0600, 0x0000},	// '9'
+		{0x0000, 0x0600, 0x0600, 0x0000, 0x0600, 0x0600, 0x0000, 0x0000},	// ':'
+		{0x0000, 0x0600, 0x0600, 0x0000, 0x0600, 0x0200, 0x0400, 0x0000},	// ';'
+		{0x0100, 0x0200, 0x0400, 0x0800, 0x0400, 0x0200, 0x0100, 0x0000},	// '<'
+		{0x0000, 0x0000, 0x0F80, 0x0000, 0x0F80, 0x0000, 0x0000, 0x0000},	// '='
+		{0x0400, 0x0200, 0x0100, 0x0080, 0x0100, 0x0200, 0x0400, 0x0000},	// '>'
+		{0x0700, 0x0880, 0x0080, 0x0100, 0x0200, 0x0000, 0x0200, 0x0000},	// '?'
+		{0x0700, 0x0880, 0x0080, 0x0680, 0x0A80, 0x0A80, 0x0700, 0x0000},	// '@'
+		{0x0700, 0x0880, 0x0880, 0x0880, 0x0F80, 0x0880, 0x0880, 0x0000},	// 'A'
+		{0x0F00, 0x0880, 0x0880, 0x0F00, 0x0880, 0x0880, 0x0F00, 0x0000},	// 'B'
+		{0x0700, 0x0880, 0x0800, 0x0800, 0x0800, 0x0880, 0x0700, 0x0000},	// 'C'
+		{0x0E00, 0x0900, 0x0880, 0x0880, 0x0880, 0x0900, 0x0E00, 0x0000},	// 'D'
+		{0x0F80, 0x0800, 0x0800, 0x0F00, 0x0800, 0x0800, 0x0F80, 0x0000},	// 'E'
+		{0x0F80, 0x0800, 0x0800, 0x0F00, 0x0800, 0x0800, 0x0800, 0x0000},	// 'F'
+		{0x0700, 0x0880, 0x0800, 0x0B80, 0x0880, 0x0880, 0x0780, 0x0000},	// 'G'
+		{0x0880, 0x0880, 0x0880, 0x0F80, 0x0880, 0x0880, 0x0880, 0x0000},	// 'H'
+		{0x0700, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0700, 0x0000},	// 'I'
+		{0x0380, 0x0100, 0x0100, 0x0100, 0x0100, 0x0900, 0x0600, 0x0000},	// 'J'
+		{0x0880, 0x0900, 0x0A00, 0x0C00, 0x0A00, 0x0900, 0x0880, 0x0000},	// 'K'
+		{0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0F80, 0x0000},	// 'L'
+		{0x0880, 0x0D80, 0x0A80, 0x0A80, 0x0880, 0x0880, 0x0880, 0x0000},	// 'M'
+		{0x0880, 0x0880, 0x0C80, 0x0A80, 0x0980, 0x0880, 0x0880, 0x0000},	// 'N'
+		{0x0700, 0x0880, 0x0880, 0x0880, 0x0880, 0x0880, 0x0700, 0x0000},	// 'O'
+		{0x0F00, 0x0880, 0x0880, 0x0F00, 0x0800, 0x0800, 0x0800, 0x0000},	// 'P'
+		{0x0700, 0x0880, 0x0880, 0x0880, 0x0A80, 0x0900, 0x0680, 0x0000},	// 'Q'
+		{0x0F00, 0x0880, 0x0880, 0x0F00, 0x0A00, 0x0900, 0x0880, 0x0000},	// 'R'
+		{0x0780, 0x0800, 0x0800, 0x0700, 0x0080, 0x0080, 0x0F00, 0x0000},	// 'S'
+		{0x0F80, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0000},	// 'T'
+		{0x0880, 0x0880, 0x0880, 0x0880, 0x0880, 0x0880, 0x0700, 0x0000},	// 'U'
+		{0x0880, 0x0880, 0x0880, 0x0880, 0x0880, 0x0500, 0x0200, 0x0000},	// 'V'
+		{0x0880, 0x0880, 0x0880, 0x0A80, 0x0A80, 0x0A80, 0x0500, 0x0000},	// 'W'
+		{0x0880, 0x0880, 0x0500, 0x0200, 0x0500, 0x0880, 0x0880, 0x0000},	// 'X'
+		{0x0880, 0x0880, 0x0880, 0x0500, 0x0200, 0x0200, 0x0200, 0x0000},	// 'Y'
+		{0x0F80, 0x0080, 0x0100, 0x0200, 0x0400, 0x0800, 0x0F80, 0x0000},	// 'Z'
+		{0x0700, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0700, 0x0000},	// '['
+		{0x0000, 0x0800, 0x0400, 0x0200, 0x0100, 0x0080, 0x0000, 0x0000},	// backslash
+		{0x0700, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0700, 0x0000},	// ']'
+		{0x0200, 0x0500, 0x0880, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '^'
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F80, 0x0000},	// '_'
+		{0x0400, 0x0200, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '`'
+		{0x0000, 0x0000, 0x0700, 0x0080, 0x0780, 0x0880, 0x0780, 0x0000},	// 'a'
+		{0x0800, 0x0800, 0x0B00, 0x0C80, 0x0880, 0x0880, 0x0F00, 0x0000},	// 'b'
+		{0x0000, 0x0000, 0x0700, 0x0800, 0x0800, 0x0880, 0x0700, 0x0000},	// 'c'
+		{0x0080, 0x0080, 0x0680, 0x0980, 0x0880, 0x0880, 0x0780, 0x0000},	// 'd'
+		{0x0000, 0x0000, 0x0700, 0x0880, 0x0F80, 0x0800, 0x0700, 0x0000},	// 'e'
+		{0x0300, 0x0480, 0x0400, 0x0E00, 0x0400, 0x0400, 0x0400, 0x0000},	// 'f'
+		{0x0000, 0x0780, 0x0880, 0x0880, 0x0780, 0x0080, 0x0700, 0x0000},	// 'g'
+		{0x0800, 0x0800, 0x0B00, 0x0C80, 0x0880, 0x0880, 0x0880, 0x0000},	// 'h'
+		{0x0200, 0x0000, 0x0600, 0x0200, 0x0200, 0x0200, 0x0700, 0x0000},	// 'i'
+		{0x0100, 0x0000, 0x0300, 0x0100, 0x0100, 0x0900, 0x0600, 0x0000},	// 'j'
+		{0x0800, 0x0800, 0x0900, 0x0A00, 0x0C00, 0x0A00, 0x0900, 0x0000},	// 'k'
+		{0x0600, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0700, 0x0000},	// 'l'
+		{0x0000, 0x0000, 0x0D00, 0x0A80, 0x0A80, 0x0880, 0x0880, 0x0000},	// 'm'
+		{0x0000, 0x0000, 0x0B00, 0x0C80, 0x0880, 0x0880, 0x0880, 0x0000},	// 'n'
+		{0x0000, 0x0000, 0x0700, 0x0880, 0x0880, 0x0880, 0x0700, 0x0000},	// 'o'
+		{0x0000, 0x0000, 0x0F00, 0x0880, 0x0F00, 0x0800, 0x0800, 0x0000},	// 'p'
+		{0x0000, 0x0000, 0x0680, 0x0980, 0x0780, 0x0080, 0x0080, 0x0000},	// 'q'
+		{0x0000, 0x0000, 0x0B00, 0x0C80, 0x0800, 0x0800, 0x0800, 0x0000},	// 'r'
+		{0x0000, 0x0000, 0x0700, 0x0800, 0x0700, 0x0080, 0x0F00, 0x0000},	// 's'
+		{0x0400, 0x0400, 0x0E00, 0x0400, 0x0400, 0x0480, 0x0300, 0x0000},	// 't'
+		{0x0000, 0x0000, 0x0880, 0x0880, 0x0880, 0x0980, 0x0680, 0x0000},	// 'u'
+		{0x0000, 0x0000, 0x0880, 0x0880, 0x0880, 0x0500, 0x0200, 0x0000},	// 'v'
+		{0x0000, 0x0000, 0x0880, 0x0880, 0x0A80, 0x0A80, 0x0500, 0x0000},	// 'w'
+		{0x0000, 0x0000, 0x0880, 0x0500, 0x0200, 0x0500, 0x0880, 0x0000},	// 'x'
+		{0x0000, 0x0000, 0x0880, 0x0880, 0x0780, 0x0080, 0x0700, 0x0000},	// 'y'
+		{0x0000, 0x0000, 0x0F80, 0x0100, 0x0200, 0x0400, 0x0F80, 0x0000},	// 'z'
+		{0x0100, 0x0200, 0x0200, 0x0400, 0x0200, 0x0200, 0x0100, 0x0000},	// '{'
+		{0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0000},	// '|'
+		{0x0400, 0x0200, 0x0200, 0x0100, 0x0200, 0x0200, 0x0400, 0x0000},	// '}'
+		{0x0400, 0x0A80, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '~'
+	},
+	{	// shifted right by 5
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// ' '
+		{0x0100, 0x0100, 0x0100, 0x0100, 0x0000, 0x0000, 0x0100, 0x0000},	// '!'
+		{0x0280, 0x0280, 0x0280, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '"'
+		{0x0280, 0x0280, 0x07C0, 0x0280, 0x07C0, 0x0280, 0x0280, 0x0000},	// '#'
+		{0x0100, 0x03C0, 0x0500, 0x0380, 0x0140, 0x0780, 0x0100, 0x0000},	// '$'
+		{0x0600, 0x0640, 0x0080, 0x0100, 0x0200, 0x04C0, 0x00C0, 0x0000},	// '%'
+		{0x0300, 0x0480, 0x0500, 0x0200, 0x0540, 0x0480, 0x0340, 0x0000},	// '&'
+		{0x0300, 0x0100, 0x0200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '''
+		{0x0080, 0x0100, 0x0200, 0x0200, 0x0200, 0x0100, 0x0080, 0x0000},	// '('
+		{0x0200, 0x0100, 0x0080, 0x0080, 0x0080, 0x0100, 0x0200, 0x0000},	// ')'
+		{0x0000, 0x0100, 0x0540, 0x0380, 0x0540, 0x0100, 0x0000, 0x0000},	// '*'
+		{0x0000, 0x0100, 0x0100, 0x07C0, 0x0100, 0x0100, 0x0000, 0x0000},	// '+'
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0100, 0x0200, 0x0000},	// ','
+		{0x0000, 0x0000, 0x0000, 0x07C0, 0x0000, 0x0000, 0x0000, 0x0000},	// '-'
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0300, 0x0000},	// '.'
+		{0x0000, 0x0040, 0x0080, 0x0100, 0x0200, 0x0400, 0x0000, 0x0000},	// '/'
+		{0x0380, 0x0440, 0x04C0, 0x0540, 0x0640, 0x0440, 0x0380, 0x0000},	// '0'
+		{0x0100, 0x0300, 0x0100, 0x0100, 0x0100, 0x0100, 0x0380, 0x0000},	// '1'
+		{0x0380, 0x0440, 0x0040, 0x0080, 0x0100, 0x0200, 0x07C0, 0x0000},	// '2'
+		{0x07C0, 0x0080, 0x0100, 0x0080, 0x0040, 0x0440, 0x0380, 0x0000},	// '3'
+		{0x0080, 0x0180, 0x0280, 0x0480, 0x07C0, 0x0080, 0x0080, 0x0000},	// '4'
+		{0x07C0, 0x0400, 0x0780, 0x0040, 0x0040, 0x0440, 0x0380, 0x0000},	// '5'
+		{0x0180, 0x0200, 0x0400, 0x0780, 0x0440, 0x0440, 0x0380, 0x0000},	// '6'
+		{0x07C0, 0x0040, 0x0080, 0x0100, 0x0200, 0x0200, 0x0200, 0x0000},	// '7'
+		{0x0380, 0x0440, 0x0440, 0x0380, 0x0440, 0x0440, 0x0380, 0x0000},	// '8'
+		{0x0380, 0x0440, 0x0440, 0x03C0, 0x0040, 0x0080, 0x0300, 0x0000},	// '9'
+		{0x0000, 0x0300, 0x0300, 0x0000, 0x0300, 0x0300, 0x0000, 0x0000},	// ':'
+		{0x0000, 0x0300, 0x0300, 0x0000, 0x0300, 0x0100, 0x0200, 0x0000},	// ';'
+		{0x0080, 0x0100, 0x0200, 0x0400, 0x0200, 0x0100, 0x0080, 0x0000},	// '<'
+		{0x0000, 0x0000, 0x07C0, 0x0000, 0x07C0, 0x0000, 0x0000, 0x0000},	// '='
+		{0x0200, 0x0100, 0x0080, 0x0040, 0x0080, 0x0100, 0x0200, 0x0000},	// '>'
+		{0x0380, 0x0440, 0x0040, 0x0080, 0x0100, 0x0000, 0x0100, 0x0000},	// '?'
+		{0x0380, 0x0440, 0x0040, 0x0340, 0x0540, 0x0540, 0x0380, 0x0000},	// '@'
+		{0x0380, 0x0440, 0x0440, 0x0440, 0x07C0, 0x0440, 0x0440, 0x0000},	// 'A'
+		{0x0780, 0x0440, 0x0440, 0x0780, 0x0440, 0x0440, 0x0780, 0x0000},	// 'B'
+		{0x0380, 0x0440, 0x0400, 0x0400, 0x0400, 0x0440, 0x0380, 0x0000},	// 'C'
+		{0x0700, 0x0480, 0x0440, 0x0440, 0x0440, 0x0480, 0x0700, 0x0000},	// 'D'
+		{0x07C0, 0x0400, 0x0400, 0x0780, 0x0400, 0x0400, 0x07C0, 0x0000},	// 'E'
+		{0x07C0, 0x0400, 0x0400, 0x0780, 0x0400, 0x0400, 0x0400, 0x0000},	// 'F'
+		{0x0380, 0x0440, 0x0400, 0x05C0, 0x0440, 0x0440, 0x03C0, 0x0000},	// 'G'
+		{0x0440, 0x0440, 0x0440, 0x07C0, 0x0440, 0x0440, 0x0440, 0x0000},	// 'H'
+		{0x0380, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0380, 0x0000},	// 'I'
+		{0x01C0, 0x0080, 0x0080, 0x0080, 0x0080, 0x0480, 0x0300, 0x0000},	// 'J'
+		{0x0440, 0x0480, 0x0500, 0x0600, 0x0500, 0x0480, 0x0440, 0x0000},	// 'K'
+		{0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x07C0, 0x0000},	// 'L'
+		{0x0440, 0x06C0, 0x0540, 0x0540, 0x0440, 0x0440, 0x0440, 0x0000},	// 'M'
+		{0x0440, 0x0440, 0x0640, 0x0540, 0x04C0, 0x0440, 0x0440, 0x0000},	// 'N'
+		{0x0380, 0x0440, 0x0440, 0x0440, 0x0440, 0x0440, 0x0380, 0x0000},	// 'O'
+		{0x0780, 0x0440, 0x0440, 0x0780, 0x0400, 0x0400, 0x0400, 0x0000},	// 'P'
+		{0x0380, 0x0440, 0x0440, 0x0440, 0x0540, 0x0480, 0x0340, 0x0000},	// 'Q'
+		{0x0780, 0x0440, 0x0440, 0x0780, 0x0500, 0x0480, 0x0440, 0x0000},	// 'R'
+		{0x03C0, 0x0400, 0x0400, 0x0380, 0x0040, 0x0040, 0x0780, 0x0000},	// 'S'
+		{0x07C0, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0000},	// 'T'
+		{0x0440, 0x0440, 0x0440, 0x0440, 0x0440, 0x0440, 0x0380, 0x0000},	// 'U'
+		{0x0440, 0x0440, 0x0440, 0x0440, 0x0440, 0x0280, 0x0100, 0x0000},	// 'V'
+		{0x0440, 0x0440, 0x0440, 0x0540, 0x0540, 0x0540, 0x0280, 0x0000},	// 'W'
+		{0x0440, 0x0440, 0x0280, 0x0100, 0x0280, 0x0440, 0x0440, 0x0000},	// 'X'
+		{0x0440, 0x0440, 0x0440, 0x0280, 0x0100, 0x0100, 0x0100, 0x0000},	// 'Y'
+		{0x07C0, 0x0040, 0x0080, 0x0100, 0x0200, 0x0400, 0x07C0, 0x0000},	// 'Z'
+		{0x0380, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0380, 0x0000},	// '['
+		{0x0000, 0x0400, 0x0200, 0x0100, 0x0080, 0x0040, 0x0000, 0x0000},	// backslash
+		{0x0380, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0380, 0x0000},	// ']'
+		{0x0100, 0x0280, 0x0440, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '^'
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07C0, 0x0000},	// '_'
+		{0x0200, 0x0100, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '`'
+		{0x0000, 0x0000, 0x0380, 0x0040, 0x03C0, 0x0440, 0x03C0, 0x0000},	// 'a'
+		{0x0400, 0x0400, 0x0580, 0x0640, 0x0440, 0x0440, 0x0780, 0x0000},	// 'b'
+		{0x0000, 0x0000, 0x0380, 0x0400, 0x0400, 0x0440, 0x0380, 0x0000},	// 'c'
+		{0x0040, 0x0040, 0x0340, 0x04C0, 0x0440, 0x0440, 0x03C0, 0x0000},	// 'd'
+		{0x0000, 0x0000, 0x0380, 0x0440, 0x07C0, 0x0400, 0x0380, 0x0000},	// 'e'
+		{0x0180, 0x0240, 0x0200, 0x0700, 0x0200, 0x0200, 0x0200, 0x0000},	// 'f'
+		{0x0000, 0x03C0, 0x0440, 0x0440, 0x03C0, 0x0040, 0x0380, 0x0000},	// 'g'
+		{0x0400, 0x0400, 0x0580, 0x0640, 0x0440, 0x0440, 0x0440, 0x0000},	// 'h'
+		{0x0100, 0x0000, 0x0300, 0x0100, 0x0100, 0x0100, 0x0380, 0x0000},	// 'i'
+		{0x0080, 0x0000, 0x0180, 0x0080, 0x0080, 0x0480, 0x0300, 0x0000},	// 'j'
+		{0x0400, 0x0400, 0x0480, 0x0500, 0x0600, 0x0500, 0x0480, 0x0000},	// 'k'
+		{0x0300, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0380, 0x0000},	// 'l'
+		{0x0000, 0x0000, 0x0680, 0x0540, 0x0540, 0x0440, 0x0440, 0x0000},	// 'm'
+		{0x0000, 0x0000, 0x0580, 0x0640, 0x0440, 0x0440, 0x0440, 0x0000},	// 'n'
+		{0x0000, 0x0000, 0x0380, 0x0440, 0x0440, 0x0440, 0x0380, 0x0000},	// 'o'
+		{0x0000, 0x0000, 0x0780, 0x0440, 0x0780, 0x0400, 0x0400, 0x0000},	// 'p'
+		{0x0000, 0x0000, 0x0340, 0x04C0, 0x03C0, 0x0040, 0x0040, 0x0000},	// 'q'
+		{0x0000, 0x0000, 0x0580, 0x0640, 0x0400, 0x0400, 0x0400, 0x0000},	// 'r'
+		{0x0000, 0x0000, 0x0380, 0x0400, 0x0380, 0x0040, 0x0780, 0x0000},	// 's'
+		{0x0200, 0x0200, 0x0700, 0x0200, 0x0200, 0x0240, 0x0180, 0x0000},	// 't'
+		{0x0000, 0x0000, 0x0440, 0x0440, 0x0440, 0x04C0, 0x0340, 0x0000},	// 'u'
+		{0x0000, 0x0000, 0x0440, 0x0440, 0x0440, 0x0280, 0x0100, 0x0000},	// 'v'
+		{0x0000, 0x0000, 0x0440, 0x0440, 0x0540, 0x0540, 0x0280, 0x0000},	// 'w'
+		{0x0000, 0x0000, 0x0440, 0x0280, 0x0100, 0x0280, 0x0440, 0x0000},	// 'x'
+		{0x0000, 0x0000, 0x0440, 0x0440, 0x03C0, 0x0040, 0x0380, 0x0000},	// 'y'
+		{0x0000, 0x0000, 0x07C0, 0x0080, 0x0100, 0x0200, 0x07C0, 0x0000},	// 'z'
+		{0x0080, 0x0100, 0x0100, 0x0200, 0x0100, 0x0100, 0x0080, 0x0000},	// '{'
+		{0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0000},	// '|'
+		{0x0200, 0x0100, 0x0100, 0x0080, 0x0100, 0x0100, 0x0200, 0x0000},	// '}'
+		{0x0200, 0x0540, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '~'
+	},
+	{	// shifted right by 6
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// ' '
+		{0x0080, 0x0080, 0x0080, 0x0080, 0x0000, 0x0000, 0x0080, 0x0000},	// '!'
+		{0x0140, 0x0140, 0x0140, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '"'
+		{0x0140, 0x0140, 0x03E0, 0x0140, 0x03E0, 0x0140, 0x0140, 0x0000},	// '#'
+		{0x0080, 0x01E0, 0x0280, 0x01C0, 0x00A0, 0x03C0, 0x0080, 0x0000},	// '$'
+		{0x0300, 0x0320, 0x0040, 0x0080, 0x0100, 0x0260, 0x0060, 0x0000},	// '%'
+		{0x0180, 0x0240, 0x0280, 0x0100, 0x02A0, 0x0240, 0x01A0, 0x0000},	// '&'
+		{0x0180, 0x0080, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '''
+		{0x0040, 0x0080, 0x0100, 0x0100, 0x0100, 0x0080, 0x0040, 0x0000},	// '('
+		{0x0100, 0x0080, 0x0040, 0x0040, 0x0040, 0x0080, 0x0100, 0x0000},	// ')'
+		{0x0000, 0x0080, 0x02A0, 0x01C0, 0x02A0, 0x0080, 0x0000, 0x0000},	// '*'
+		{0x0000, 0x0080, 0x0080, 0x03E0, 0x0080, 0x0080, 0x0000, 0x0000},	// '+'
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0180, 0x0080, 0x0100, 0x0000},	// ','
+		{0x0000, 0x0000, 0x0000, 0x03E0, 0x0000, 0x0000, 0x0000, 0x0000},	// '-'
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0180, 0x0180, 0x0000},	// '.'
+		{0x0000, 0x0020, 0x0040, 0x0080, 0x0100, 0x0200, 0x0000, 0x0000},	// '/'
+		{0x01C0, 0x0220, 0x0260, 0x02A0, 0x0320, 0x0220, 0x01C0, 0x0000},	// '0'
+		{0x0080, 0x0180, 0x0080, 0x0080, 0x0080, 0x0080, 0x01C0, 0x0000},	// '1'
+		{0x01C0, 0x0220, 0x0020, 0x0040, 0x0080, 0x0100, 0x03E0, 0x0000},	// '2'
+		{0x03E0, 0x0040, 0x0080, 0x0040, 0x0020, 0x0220, 0x01C0, 0x0000},	// '3'
+		{0x0040, 0x00C0, 0x0140, 0x0240, 0x03E0, 0x0040, 0x0040, 0x0000},	// '4'
+		{0x03E0, 0x0200, 0x03C0, 0x0020, 0x0020, 0x0220, 0x01C0, 0x0000},	// '5'
+		{0x00C0, 0x0100, 0x0200, 0x03C0, 0x0220, 0x0220, 0x01C0, 0x0000},	// '6'
+		{0x03E0, 0x0020, 0x0040, 0x0080, 0x0100, 0x0100, 0x0100, 0x0000},	// '7'
+		{0x01C0, 0x0220, 0x0220, 0x01C0, 0x0220, 0x0220, 0x01C0, 0x0000},	// '8'
+		{0x01C0, 0x0220, 0x0220, 0x01E0, 0x0020, 0x0040, 0x0180, 0x0000},	// '9'
+		{0x0000, 0x0180, 0x0180, 0x0000, 0x0180, 0x0180, 0x0000, 0x0000},	// ':'
+		{0x0000, 0x0180, 0x0180, 0x0000, 0x0180, 0x0080, 0x0100, 0x0000},	// ';'
+		{0x0040, 0x0080, 0x0100, 0x0200, 0x0100, 0x0080, 0x0040, 0x0000},	// '<'
+		{0x0000, 0x0000, 0x03E0, 0x0000, 0x03E0, 0x0000, 0x0000, 0x0000},	// '='
+		{0x0100, 0x0080, 0x0040, 0x0020, 0x0040, 0x0080, 0x0100, 0x0000},	// '>'
+		{0x01C0, 0x0220, 0x0020, 0x0040, 0x0080, 0x0000, 0x0080, 0x0000},	// '?'
+		{0x01C0, 0x0220, 0x0020, 0x01A0, 0x02A0, 0x02A0, 0x01C0, 0x0000},	// '@'
+		{0x01C0, 0x0220, 0x0220, 0x0220, 0x03E0, 0x0220, 0x0220, 0x0000},	// 'A'
+		{0x03C0, 0x0220, 0x0220, 0x03C0, 0x0220, 0x0220, 0x03C0, 0x0000},	// 'B'
+		{0x01C0, 0x0220, 0x0200, 0x0200, 0x0200, 0x0220, 0x01C0, 0x0000},	// 'C'
+		{0x0380, 0x0240, 0x0220, 0x0220, 0x0220, 0x0240, 0x0380, 0x0000},	// 'D'
+		{0x03E0, 0x0200, 0x0200, 0x03C0, 0x0200, 0x0200, 0x03E0, 0x0000},	// 'E'
+		{0x03E0, 0x0200, 0x0200, 0x03C0, 0x0200, 0x0200, 0x0200, 0x0000},	// 'F'
+		{0x01C0, 0x0220, 0x0200, 0x02E0, 0x0220, 0x0220, 0x01E0, 0x0000},	// 'G'
+		{0x0220, 0x0220, 0x0220, 0x03E0, 0x0220, 0x0220, 0x0220, 0x0000},	// 'H'
+		{0x01C0, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x01C0, 0x0000},	// 'I'
+		{0x00E0, 0x0040, 0x0040, 0x0040, 0x0040, 0x0240, 0x0180, 0x0000},	// 'J'
+		{0x0220, 0x0240, 0x0280, 0x0300, 0x0280, 0x0240, 0x0220, 0x0000},	// 'K'
+		{0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x03E0, 0x0000},	// 'L'
+		{0x0220, 0x0360, 0x02A0, 0x02A0, 0x0220, 0x0220, 0x0220, 0x0000},	// 'M'
+		{0x0220, 0x0220, 0x0320, 0x02A0, 0x0260, 0x0220, 0x0220, 0x0000},	// 'N'
+		{0x01C0, 0x0220, 0x0220, 0x0220, 0x0220, 0x0220, 0x01C0, 0x0000},	// 'O'
+		{0x03C0, 0x0220, 0x0220, 0x03C0, 0x0200, 0x0200, 0x0200, 0x0000},	// 'P'
+		{0x01C0, 0x0220, 0x0220, 0x0220, 0x02A0, 0x0240, 0x01A0, 0x0000},	// 'Q'
+		{0x03C0, 0x0220, 0x0220, 0x03C0, 0x0280, 0x0240, 0x0220, 0x0000},	// 'R'
+		{0x01E0, 0x0200, 0x0200, 0x01C0, 0x0020, 0x0020, 0x03C0, 0x0000},	// 'S'
+		{0x03E0, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0000},	// 'T'
+		{0x0220, 0x0220, 0x0220, 0x0220, 0x0220, 0x0220, 0x01C0, 0x0000},	// 'U'
+		{0x0220, 0x0220, 0x0220, 0x0220, 0x0220, 0x0140, 0x0080, 0x0000},	// 'V'
+		{0x0220, 0x0220, 0x0220, 0x02A0, 0x02A0, 0x02A0, 0x0140, 0x0000},	// 'W'
+		{0x0220, 0x0220, 0x0140, 0x0080, 0x0140, 0x0220, 0x0220, 0x0000},	// 'X'
+		{0x0220, 0x0220, 0x0220, 0x0140, 0x0080, 0x0080, 0x0080, 0x0000},	// 'Y'
+		{0x03E0, 0x0020, 0x0040, 0x0080, 0x0100, 0x0200, 0x03E0, 0x0000},	// 'Z'
+		{0x01C0, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x01C0, 0x0000},	// '['
+		{0x0000, 0x0200, 0x0100, 0x0080, 0x0040, 0x0020, 0x0000, 0x0000},	// backslash
+		{0x01C0, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x01C0, 0x0000},	// ']'
+		{0x0080, 0x0140, 0x0220, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '^'
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03E0, 0x0000},	// '_'
+		{0x0100, 0x0080, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '`'
+		{0x0000, 0x0000, 0x01C0, 0x0020, 0x01E0, 0x0220, 0x01E0, 0x0000},	// 'a'
+		{0x0200, 0x0200, 0x02C0, 0x0320, 0x0220, 0x0220, 0x03C0, 0x0000},	// 'b'
+		{0x0000, 0x0000, 0x01C0, 0x0200, 0x0200, 0x0220, 0x01C0, 0x0000},	// 'c'
+		{0x0020, 0x0020, 0x01A0, 0x0260, 0x0220, 0x0220, 0x01E0, 0x0000},	// 'd'
+		{0x0000, 0x0000, 0x01C0, 0x0220, 0x03E0, 0x0200, 0x01C0, 0x0000},	// 'e'
+		{0x00C0, 0x0120, 0x0100, 0x0380, 0x0100, 0x0100, 0x0100, 0x0000},	// 'f'
+		{0x0000, 0x01E0, 0x0220, 0x0220, 0x01E0, 0x0020, 0x01C0, 0x0000},	// 'g'
+		{0x0200, 0x0200, 0x02C0, 0x0320, 0x0220, 0x0220, 0x0220, 0x0000},	// 'h'
+		{0x0080, 0x0000, 0x0180, 0x0080, 0x0080, 0x0080, 0x01C0, 0x0000},	// 'i'
+		{0x0040, 0x0000, 0x00C0, 0x0040, 0x0040, 0x0240, 0x0180, 0x0000},	// 'j'
+		{0x0200, 0x0200, 0x0240, 0x0280, 0x0300, 0x0280, 0x0240, 0x0000},	// 'k'
+		{0x0180, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x01C0, 0x0000},	// 'l'
+		{0x0000, 0x0000, 0x0340, 0x02A0, 0x02A0, 0x0220, 0x0220, 0x0000},	// 'm'
+		{0x0000, 0x0000, 0x02C0, 0x0320, 0x0220, 0x0220, 0x0220, 0x0000},	// 'n'
+		{0x0000, 0x0000, 0x01C0, 0x0220, 0x0220, 0x0220, 0x01C0, 0x0000},	// 'o'
+		{0x0000, 0x0000, 0x03C0, 0x0220, 0x03C0, 0x0200, 0x0200, 0x0000},	// 'p'
+		{0x0000, 0x0000, 0x01A0, 0x0260, 0x01E0, 0x0020, 0x0020, 0x0000},	// 'q'
+		{0x0000, 0x0000, 0x02C0, 0x0320, 0x0200, 0x0200, 0x0200, 0x0000},	// 'r'
+		{0x0000, 0x0000, 0x01C0, 0x0200, 0x01C0, 0x0020, 0x03C0, 0x0000},	// 's'
+		{0x0100, 0x0100, 0x0380, 0x0100, 0x0100, 0x0120, 0x00C0, 0x0000},	// 't'
+		{0x0000, 0x0000, 0x0220, 0x0220, 0x0220, 0x0260, 0x01A0, 0x0000},	// 'u'
+		{0x0000, 0x0000, 0x0220, 0x0220, 0x0220, 0x0140, 0x0080, 0x0000},	// 'v'
+		{0x0000, 0x0000, 0x0220, 0x0220, 0x02A0, 0x02A0, 0x0140, 0x0000},	// 'w'
+		{0x0000, 0x0000, 0x0220, 0x0140, 0x0080, 0x0140, 0x0220, 0x0000},	// 'x'
+		{0x0000, 0x0000, 0x0220, 0x0220, 0x01E0, 0x0020, 0x01C0, 0x0000},	// 'y'
+		{0x0000, 0x0000, 0x03E0, 0x0040, 0x0080, 0x0100, 0x03E0, 0x0000},	// 'z'
+		{0x0040, 0x0080, 0x0080, 0x0100, 0x0080, 0x0080, 0x0040, 0x0000},	// '{'
+		{0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0000},	// '|'
+		{0x0100, 0x0080, 0x0080, 0x0040, 0x0080, 0x0080, 0x0100, 0x0000},	// '}'
+		{0x0100, 0x02A0, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '~'
+	},
+	{	// shifted right by 7
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// ' '
+		{0x0040, 0x0040, 0x0040, 0x0040, 0x0000, 0x0000, 0x0040, 0x0000},	// '!'
+		{0x00A0, 0x00A0, 0x00A0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '"'
+		{0x00A0, 0x00A0, 0x01F0, 0x00A0, 0x01F0, 0x00A0, 0x00A0, 0x0000},	// '#'
+		{0x0040, 0x00F0, 0x0140, 0x00E0, 0x0050, 0x01E0, 0x0040, 0x0000},	// '$'
+		{0x0180, 0x0190, 0x0020, 0x0040, 0x0080, 0x0130, 0x0030, 0x0000},	// '%'
+		{0x00C0, 0x0120, 0x0140, 0x0080, 0x0150, 0x0120, 0x00D0, 0x0000},	// '&'
+		{0x00C0, 0x0040, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '''
+		{0x0020, 0x0040, 0x0080, 0x0080, 0x0080, 0x0040, 0x0020, 0x0000},	// '('
+		{0x0080, 0x0040, 0x0020, 0x0020, 0x0020, 0x0040, 0x0080, 0x0000},	// ')'
+		{0x0000, 0x0040, 0x0150, 0x00E0, 0x0150, 0x0040, 0x0000, 0x0000},	// '*'
+		{0x0000, 0x0040, 0x0040, 0x01F0, 0x0040, 0x0040, 0x0000, 0x0000},	// '+'
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x00C0, 0x0040, 0x0080, 0x0000},	// ','
+		{0x0000, 0x0000, 0x0000, 0x01F0, 0x0000, 0x0000, 0x0000, 0x0000},	// '-'
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00C0, 0x00C0, 0x0000},	// '.'
+		{0x0000, 0x0010, 0x0020, 0x0040, 0x0080, 0x0100, 0x0000, 0x0000},	// '/'
+		{0x00E0, 0x0110, 0x0130, 0x0150, 0x0190, 0x0110, 0x00E0, 0x0000},	// '0'
+		{0x0040, 0x00C0, 0x0040, 0x0040, 0x0040, 0x0040, 0x00E0, 0x0000},	// '1'
+		{0x00E0, 0x0110, 0x0010, 0x0020, 0x0040, 0x0080, 0x01F0, 0x0000},	// '2'
+		{0x01F0, 0x0020, 0x0040, 0x0020, 0x0010, 0x0110, 0x00E0, 0x0000},	// '3'
+		{0x0020, 0x0060, 0x00A0, 0x0120, 0x01F0, 0x0020, 0x0020, 0x0000},	// '4'
+		{0x01F0, 0x0100, 0x01E0, 0x0010, 0x0010, 0x0110, 0x00E0, 0x0000},	// '5'
+		{0x0060, 0x0080, 0x0100, 0x01E0, 0x0110, 0x0110, 0x00E0, 0x0000},	// '6'
+		{0x01F0, 0x0010, 0x0020, 0x0040, 0x0080, 0x0080, 0x0080, 0x0000},	// '7'
+		{0x00E0, 0x0110, 0x0110, 0x00E0, 0x0110, 0x0110, 0x00E0, 0x0000},	// '8'
+		{0x00E0, 0x0110, 0x0110, 0x00F0, 0x0010, 0x0020, 0x00C0, 0x0000},	// '9'
+		{0x0000, 0x00C0, 0x00C0, 0x0000, 0x00C0, 0x00C0, 0x0000, 0x0000},	// ':'
+		{0x0000, 0x00C0, 0x00C0, 0x0000, 0x00C0, 0x0040, 0x0080, 0x0000},	// ';'
+		{0x0020, 0x0040, 0x0080, 0x0100, 0x0080, 0x0040, 0x0020, 0x0000},	// '<'
+		{0x0000, 0x0000, 0x01F0, 0x0000, 0x01F0, 0x0000, 0x0000, 0x0000},	// '='
+		{0x0080, 0x0040, 0x0020, 0x0010, 0x0020, 0x0040, 0x0080, 0x0000},	// '>'
+		{0x00E0, 0x0110, 0x0010, 0x0020, 0x0040, 0x0000, 0x0040, 0x0000},	// '?'
+		{0x00E0, 0x0110, 0x0010, 0x00D0, 0x0150, 0x0150, 0x00E0, 0x0000},	// '@'
+		{0x00E0, 0x0110, 0x0110, 0x0110, 0x01F0, 0x0110, 0x0110, 0x0000},	// 'A'
+		{0x01E0, 0x0110, 0x0110, 0x01E0, 0x0110, 0x0110, 0x01E0, 0x0000},	// 'B'
+		{0x00E0, 0x0110, 0x0100, 0x0100, 0x0100, 0x0110, 0x00E0, 0x0000},	// 'C'
+		{0x01C0, 0x0120, 0x0110, 0x0110, 0x0110, 0x0120, 0x01C0, 0x0000},	// 'D'
+		{0x01F0, 0x0100, 0x0100, 0x01E0, 0x0100, 0x0100, 0x01F0, 0x0000},	// 'E'
+		{0x01F0, 0x0100, 0x0100, 0x01E0, 0x0100, 0x0100, 0x0100, 0x0000},	// 'F'
+		{0x00E0, 0x0110, 0x0100, 0x0170, 0x0110, 0x0110, 0x00F0, 0x0000},	// 'G'
+		{0x0110, 0x0110, 0x0110, 0x01F0, 0x0110, 0x0110, 0x0110, 0x0000},	// 'H'
+		{0x00E0, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x00E0, 0x0000},	// 'I'
+		{0x0070, 0x0020, 0x0020, 0x0020, 0x0020, 0x0120, 0x00C0, 0x0000},	// 'J'
+		{0x0110, 0x0120, 0x0140, 0x0180, 0x0140, 0x0120, 0x0110, 0x0000},	// 'K'
+		{0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x01F0, 0x0000},	// 'L'
+		{0x0110, 0x01B0, 0x0150, 0x0150, 0x0110, 0x0110, 0x0110, 0x0000},	// 'M'
+		{0x0110, 0x0110, 0x0190, 0x0150, 0x0130, 0x0110, 0x0110, 0x0000},	// 'N'
+		{0x00E0, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x00E0, 0x0000},	// 'O'
+		{0x01E0, 0x0110, 0x0110, 0x01E0, 0x0100, 0x0100, 0x0100, 0x0000},	// 'P'
+		{0x00E0, 0x0110, 0x0110, 0x0110, 0x0150, 0x0120, 0x00D0, 0x0000},	// 'Q'
+		{0x01E0, 0x0110, 0x0110, 0x01E0, 0x0140, 0x0120, 0x0110, 0x0000},	// 'R'
+		{0x00F0, 0x0100, 0x0100, 0x00E0, 0x0010, 0x0010, 0x01E0, 0x0000},	// 'S'
+		{0x01F0, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0000},	// 'T'
+		{0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x00E0, 0x0000},	// 'U'
+		{0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x00A0, 0x0040, 0x0000},	// 'V'
+		{0x0110, 0x0110, 0x0110, 0x0150, 0x0150, 0x0150, 0x00A0, 0x0000},	// 'W'
+		{0x0110, 0x0110, 0x00A0, 0x0040, 0x00A0, 0x0110, 0x0110, 0x0000},	// 'X'
+		{0x0110, 0x0110, 0x0110, 0x00A0, 0x0040, 0x0040, 0x0040, 0x0000},	// 'Y'
+		{0x01F0, 0x0010, 0x0020, 0x0040, 0x0080, 0x0100, 0x01F0, 0x0000},	// 'Z'
+		{0x00E0, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x00E0, 0x0000},	// '['
+		{0x0000, 0x0100, 0x0080, 0x0040, 0x0020, 0x0010, 0x0000, 0x0000},	// backslash
+		{0x00E0, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x00E0, 0x0000},	// ']'
+		{0x0040, 0x00A0, 0x0110, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '^'
+		{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01F0, 0x0000},	// '_'
+		{0x0080, 0x0040, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '`'
+		{0x0000, 0x0000, 0x00E0, 0x0010, 0x00F0, 0x0110, 0x00F0, 0x0000},	// 'a'
+		{0x0100, 0x0100, 0x0160, 0x0190, 0x0110, 0x0110, 0x01E0, 0x0000},	// 'b'
+		{0x0000, 0x0000, 0x00E0, 0x0100, 0x0100, 0x0110, 0x00E0, 0x0000},	// 'c'
+		{0x0010, 0x0010, 0x00D0, 0x0130, 0x0110, 0x0110, 0x00F0, 0x0000},	// 'd'
+		{0x0000, 0x0000, 0x00E0, 0x0110, 0x01F0, 0x0100, 0x00E0, 0x0000},	// 'e'
+		{0x0060, 0x0090, 0x0080, 0x01C0, 0x0080, 0x0080, 0x0080, 0x0000},	// 'f'
+		{0x0000, 0x00F0, 0x0110, 0x0110, 0x00F0, 0x0010, 0x00E0, 0x0000},	// 'g'
+		{0x0100, 0x0100, 0x0160, 0x0190, 0x0110, 0x0110, 0x0110, 0x0000},	// 'h'
+		{0x0040, 0x0000, 0x00C0, 0x0040, 0x0040, 0x0040, 0x00E0, 0x0000},	// 'i'
+		{0x0020, 0x0000, 0x0060, 0x0020, 0x0020, 0x0120, 0x00C0, 0x0000},	// 'j'
+		{0x0100, 0x0100, 0x0120, 0x0140, 0x0180, 0x0140, 0x0120, 0x0000},	// 'k'
+		{0x00C0, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x00E0, 0x0000},	// 'l'
+		{0x0000, 0x0000, 0x01A0, 0x0150, 0x0150, 0x0110, 0x0110, 0x0000},	// 'm'
+		{0x0000, 0x0000, 0x0160, 0x0190, 0x0110, 0x0110, 0x0110, 0x0000},	// 'n'
+		{0x0000, 0x0000, 0x00E0, 0x0110, 0x0110, 0x0110, 0x00E0, 0x0000},	// 'o'
+		{0x0000, 0x0000, 0x01E0, 0x0110, 0x01E0, 0x0100, 0x0100, 0x0000},	// 'p'
+		{0x0000, 0x0000, 0x00D0, 0x0130, 0x00F0, 0x0010, 0x0010, 0x0000},	// 'q'
+		{0x0000, 0x0000, 0x0160, 0x0190, 0x0100, 0x0100, 0x0100, 0x0000},	// 'r'
+		{0x0000, 0x0000, 0x00E0, 0x0100, 0x00E0, 0x0010, 0x01E0, 0x0000},	// 's'
+		{0x0080, 0x0080, 0x01C0, 0x0080, 0x0080, 0x0090, 0x0060, 0x0000},	// 't'
+		{0x0000, 0x0000, 0x0110, 0x0110, 0x0110, 0x0130, 0x00D0, 0x0000},	// 'u'
+		{0x0000, 0x0000, 0x0110, 0x0110, 0x0110, 0x00A0, 0x0040, 0x0000},	// 'v'
+		{0x0000, 0x0000, 0x0110, 0x0110, 0x0150, 0x0150, 0x00A0, 0x0000},	// 'w'
+		{0x0000, 0x0000, 0x0110, 0x00A0, 0x0040, 0x00A0, 0x0110, 0x0000},	// 'x'
+		{0x0000, 0x0000, 0x0110, 0x0110, 0x00F0, 0x0010, 0x00E0, 0x0000},	// 'y'
+		{0x0000, 0x0000, 0x01F0, 0x0020, 0x0040, 0x0080, 0x01F0, 0x0000},	// 'z'
+		{0x0020, 0x0040, 0x0040, 0x0080, 0x0040, 0x0040, 0x0020, 0x0000},	// '{'
+		{0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0000},	// '|'
+		{0x0080, 0x0040, 0x0040, 0x0020, 0x0040, 0x0040, 0x0080, 0x0000},	// '}'
+		{0x0080, 0x0150, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},	// '~'
+	},
+#endif
+};
 
-			//write last byte
-			*pucData |= uclast_x_byte;
-		}
+//*****************************************************************************
+//
+//! Draws a string of text on the screen.
+//!
+//! \param context is a pointer to the drawing context to use.
+//! \param pcString is a pointer to the string to be drawn.
+//! \param lLength is the number of characters from the string that should be
+//! drawn on the screen, or AUTO_STRING_LENGTH for the whole string.
+//! \param lX is the X coordinate of the upper left corner of the string
+//! position on the screen.
+//! \param lY is the Y coordinate of the upper left corner of the string
+//! position on the screen.
+//! \param bOpaque is true if the background of each character should be drawn
+//! and false if it should not (leaving the background as is).
+//!
+//! This is a faster replacement for Graphics_drawString. For g_sFontFixed6x8
+//! on this display the glyphs come from the glyph tables and are written
+//! straight into the DisplayBuffer, clipped to the context's clipping region.
+//! Any other font or display is passed on to Graphics_drawString.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Sharp96x96_DrawString(const Graphics_Context *context,
+                           const char *pcString, int32_t lLength,
+                           int32_t lX, int32_t lY, bool bOpaque)
+{
+	void *pvDisplayData;
+	const uint16_t *puiGlyph;
+	uint16_t uiFore, uiBack, uiCell, uiGlyph, uiMask, uiBits;
+	int16_t lPos, lMin, lMax, lLine, lByte;
+	uint8_t ucCell, ucShift, ucChar, i;
+
+	if((context->font != &g_sFontFixed6x8) ||
+	   (context->display != &g_sharp96x96LCD))
+	{
+		Graphics_drawString(context, (uint8_t *)pcString, lLength, lX, lY, bOpaque);
+		return;
 	}
-	//only one data byte
-	else
+
+	DrainTile();
+
+	pvDisplayData = context->display->displayData;
+	uiFore = (ClrBlack == context->foreground) ? 0x0000 : 0xFFFF;
+	uiBack = (ClrBlack == context->background) ? 0x0000 : 0xFFFF;
+
+	// The clipping range along a DisplayBuffer row
+#ifdef ROTATE_90
+	lMin = context->clipRegion.yMin;
+	lMax = context->clipRegion.yMax;
+#else
+	lMin = context->clipRegion.xMin;
+	lMax = context->clipRegion.xMax;
+#endif
+
+#ifdef NON_VOLATILE_MEMORY_BUFFER
+	PrepareMemoryWrite();
+#endif
+
+	for(; lLength && *pcString; lLength--, pcString++, lX += GLYPH_WIDTH)
 	{
-		//calculate value of single byte
-		ucfirst_x_byte &= uclast_x_byte;
+		// Characters without a glyph are drawn as a '.'
+		ucChar = *pcString;
+		if((ucChar < ' ') || (ucChar > '~'))
+		{
+			ucChar = '.';
+		}
 
-		//set buffer to correct location
-		pucData = &DisplayBuffer[lY][x_index_min];
+#ifdef ROTATE_90
+		lPos = lY;
+#else
+		lPos = lX;
+#endif
 
-		//draw black pixels (clear bits)
-		if(ClrBlack == ulValue)
+		// Bits of the glyph cell which fall inside the clipping range
+		if((lPos + 7 < lMin) || (lPos > lMax))
 		{
-			*pucData++ &= ~ucfirst_x_byte;
+			continue;
 		}
-		//white pixels (set bits)
-		else
+		ucCell = GLYPH_CELL;
+		if(lPos < lMin)
 		{
-			*pucData++ |= ucfirst_x_byte;
+			ucCell &= 0xFF >> (lMin - lPos);
+		}
+		if(lPos + 7 > lMax)
+		{
+			ucCell &= 0xFF << (lPos + 7 - lMax);
+		}
+
+		lByte = ((lPos + 8) >> 3) - 1;
+		ucShift = (lPos + 8) & 0x7;
+		puiGlyph = Glyphs[ucShift][ucChar - ' '];
+		uiCell = ((uint16_t)ucCell << 8) >> ucShift;
+
+		for(i = 0; i < GLYPH_LINES; i++)
+		{
+#ifdef ROTATE_90
+			if(((lX + i) < context->clipRegion.xMin) ||
+			   ((lX + i) > context->clipRegion.xMax))
+			{
+				continue;
+			}
+			lLine = LCD_HORIZONTAL_MAX - (lX + i) - 1;
+#else
+			if(((lY + i) < context->clipRegion.yMin) ||
+			   ((lY + i) > context->clipRegion.yMax))
+			{
+				continue;
+			}
+			lLine = lY + i;
+#endif
+
+			uiGlyph = puiGlyph[i];
+			uiMask = bOpaque ? uiCell : (uiGlyph & uiCell);
+			uiBits = (uiGlyph & uiFore) | (~uiGlyph & uiBack);
+
+			if(uiMask >> 8)
+			{
+				DisplayData(lLine, lByte) = (DisplayData(lLine, lByte) & ~(uiMask >> 8)) |
+				                            ((uiBits & uiMask) >> 8);
+			}
+			if(uiMask & 0xFF)
+			{
+				DisplayData(lLine, lByte + 1) = (DisplayData(lLine, lByte + 1) & ~uiMask) |
+				                                (uiBits & uiMask);
+			}
+
+			MarkLineDirty(lLine);
 		}
 	}
 
@@ -311,279 +2566,553 @@ static void Sharp96x96_LineDrawH(void *pvDisplayData, int16_t lX1, int16_t lX2,
 #endif
 }
 
+//*****************************************************************************
+//
+//! Draws a centered string of text on the screen.
+//!
+//! \param context is a pointer to the drawing context to use.
+//! \param pcString is a pointer to the string to be drawn.
+//! \param lLength is the number of characters from the string that should be
+//! drawn on the screen, or AUTO_STRING_LENGTH for the whole string.
+//! \param lX is the X coordinate of the center of the string position on the
+//! screen.
+//! \param lY is the Y coordinate of the center of the string position on the
+//! screen.
+//! \param bOpaque is true if the background of each character should be drawn
+//! and false if it should not (leaving the background as is).
+//!
+//! This is a faster replacement for Graphics_drawStringCentered, placing the
+//! string the same way. See Sharp96x96_DrawString.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Sharp96x96_DrawStringCentered(const Graphics_Context *context,
+                                   const char *pcString, int32_t lLength,
+                                   int32_t lX, int32_t lY, bool bOpaque)
+{
+	int32_t lCount = 0;
+
+	if((context->font != &g_sFontFixed6x8) ||
+	   (context->display != &g_sharp96x96LCD))
+	{
+		Graphics_drawStringCentered(context, (uint8_t *)pcString, lLength, lX, lY,
+		                            bOpaque);
+		return;
+	}
+
+	// Every glyph of the fixed font has the same width
+	while((lCount != lLength) && pcString[lCount])
+	{
+		lCount++;
+	}
+
+	Sharp96x96_DrawString(context, pcString, lCount,
+	                      lX - ((lCount * GLYPH_WIDTH) / 2),
+	                      lY - (g_sFontFixed6x8.baseline / 2), bOpaque);
+}
 
 //*****************************************************************************
 //
-//! Draws a vertical line.
+//! Translates a 24-bit RGB color to a display driver-specific color.
 //!
 //! \param pvDisplayData is a pointer to the driver-specific data for this
 //! display driver.
-//! \param lX is the X coordinate of the line.
-//! \param lY1 is the Y coordinate of the start of the line.
-//! \param lY2 is the Y coordinate of the end of the line.
-//! \param ulValue is the color of the line.
+//! \param ulValue is the 24-bit RGB color.  The least-significant byte is the
+//! blue channel, the next byte is the green channel, and the third byte is the
+//! red channel.
 //!
-//! This function draws a vertical line on the display.  The coordinates of the
-//! line are assumed to be within the extents of the display.
+//! This function translates a 24-bit RGB color into a value that can be
+//! written into the display's frame buffer in order to reproduce that color,
+//! or the closest possible approximation of that color.
 //!
-//! \return None.
+//! \return Returns the display-driver specific color.
 //
 //*****************************************************************************
-static void Sharp96x96_LineDrawV(void *pvDisplayData, int16_t lX, int16_t lY1,
-                                   int16_t lY2, uint16_t ulValue)
+static uint32_t Sharp96x96_ColorTranslate(void *pvDisplayData,
+                                          uint32_t ulValue)
 {
-#ifdef ROTATE_90
-	uint16_t temp = lY2;
-	lY2 = LCD_HORIZONTAL_MAX - lX  - 1;
-	lY1 = LCD_HORIZONTAL_MAX - lY1 - 1;
-	lX = temp;
+    //
+    // Translate from a 24-bit RGB color to mono color.
+    //
+    return(DPYCOLORTRANSLATE(ulValue));
+}
+
+
+//*****************************************************************************
+//
+//! Finds the next block of bytes to send for the frame being flushed.
+//!
+//! \param ppucData receives a pointer to the first byte of the block.
+//!
+//! With USE_SPI_TX_QUEUE this is called from the USCI_B0 interrupt each time
+//! the previous block has been sent.
+//!
+//! Starting at FlushLine, this function looks for the next row which is
+//! marked dirty and marks it clean. Without WIRE_FORMAT_BUFFER the row is
+//! copied into LinePacket in the panel's wire format (line address, line
+//! data and trailer byte). With WIRE_FORMAT_BUFFER the rows are already
+//! stored that way, so the block is every consecutive dirty row, taken in
+//! place from the DisplayBuffer. Once every row has been examined the block
+//! is the final trailer byte which ends the multiple line write.
+//!
+//! \return Returns the number of bytes in the block, or 0 when the frame is
+//! already complete.
+//
+//*****************************************************************************
+static uint16_t Sharp96x96_NextTransfer(const uint8_t **ppucData)
+{
+#ifndef WIRE_FORMAT_BUFFER
+	uint8_t *pucData;
+	uint8_t *pucPacket = LinePacket;
+	int16_t xi = 0;
 #endif
-	volatile uint16_t yi = 0;
-	volatile uint16_t x_index = lX>>3;
-	volatile uint8_t data_byte;
+	int16_t xj;
 
-#ifdef NON_VOLATILE_MEMORY_BUFFER
-	PrepareMemoryWrite();
+	if(FlushLine > LCD_VERTICAL_MAX)
+		return 0;
+
+	while(FlushLine < LCD_VERTICAL_MAX)
+	{
+		xj = FlushLine++;
+
+		if(!IsLineQueued(xj))
+			continue;
+
+		ClearLineQueued(xj);
+
+#ifdef WIRE_FORMAT_BUFFER
+		*ppucData = &FrontBuffer[xj][0];
+
+		// Extend the block over the following dirty rows
+		while((FlushLine < LCD_VERTICAL_MAX) && IsLineQueued(FlushLine))
+		{
+			ClearLineQueued(FlushLine);
+			FlushLine++;
+		}
+
+		// A block reaching the last row also takes the final trailer
+		if(FlushLine == LCD_VERTICAL_MAX)
+		{
+			FlushLine++;
+			FlushBytes += ((FlushLine - xj - 1) * LCD_ROW_STRIDE) + 1;
+			return ((FlushLine - xj - 1) * LCD_ROW_STRIDE) + 1;
+		}
+
+		FlushBytes += (FlushLine - xj) * LCD_ROW_STRIDE;
+		return (FlushLine - xj) * LCD_ROW_STRIDE;
+#else
+#ifdef LANDSCAPE
+		pucData = &FrontBuffer[xj][0];
+		*pucPacket++ = reverse(xj + 1);
+
+		for(xi=0; xi<(LCD_HORIZONTAL_MAX>>3); xi++)
+		{
+			*pucPacket++ = *(pucData++);
+		}
 #endif
+#ifdef LANDSCAPE_FLIP
+		pucData = &FrontBuffer[xj][(LCD_HORIZONTAL_MAX>>3)-1];
+		*pucPacket++ = reverse(LCD_VERTICAL_MAX - xj);
+
+		for(xi=0; xi<(LCD_HORIZONTAL_MAX>>3); xi++)
+		{
+			*pucPacket++ = reverse(*pucData--);
+		}
+#endif
+		*pucPacket++ = SHARP_LCD_TRAILER_BYTE;
+
+		*ppucData = LinePacket;
+		FlushBytes += (pucPacket - LinePacket);
+		return (pucPacket - LinePacket);
+#endif
+	}
+
+	// All rows examined, close out the multiple line write
+	FlushLine++;
+#ifdef WIRE_FORMAT_BUFFER
+	*ppucData = &FrontBuffer[LCD_VERTICAL_MAX][0];
+#else
+	*pucPacket = SHARP_LCD_TRAILER_BYTE;
+	*ppucData = LinePacket;
+#endif
+
+	FlushBytes++;
+	return 1;
+}
+
+#ifdef DOUBLE_BUFFER
+//*****************************************************************************
+//
+//! Swaps the front and back buffers.
+//!
+//! The buffer drawn into so far becomes the front buffer and its dirty rows
+//! become the rows to flush. Those rows, or all of them after a clear screen,
+//! are copied into the new back buffer, so it again holds the complete picture
+//! and drawing can continue on top of it.
+//!
+//! Must only be called from thread context, since it changes the buffer the
+//! primitives draw into.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void Sharp96x96_SwapBuffers(void)
+{
+	uint8_t (*pucBack)[LCD_ROW_STRIDE] = FrontBuffer;
+	uint8_t *pucSrc;
+	uint8_t *pucDst;
+	uint16_t xi;
+	uint16_t xj;
 
-	//calculate data byte
-	//mod by 8 and shift this # bits
-	data_byte = (0x80 >> (lX & 0x7));     
+	FrontBuffer = g_sharp96x96LCD.displayData;
+	g_sharp96x96LCD.displayData = pucBack;
 
-	//write data to the display buffer
-	for(yi = lY1; yi <= lY2; yi++){
+	for(xj=0; xj<(LCD_VERTICAL_MAX>>3); xj++)
+	{
+		FlushLines[xj] = DirtyLines[xj];
+		DirtyLines[xj] = 0;
+	}
 
-		//black pixels (clear bits)
-		if(ClrBlack == ulValue)
-		{
-			DisplayBuffer[yi][x_index] &= ~data_byte;
-		}
-		//white pixels (set bits)
-		else
+	for(xj=0; xj<LCD_VERTICAL_MAX; xj++)
+	{
+		if(!FrontStale && !IsLineQueued(xj))
+			continue;
+
+		pucSrc = &FrontBuffer[xj][LCD_ROW_OFFSET];
+		pucDst = &pucBack[xj][LCD_ROW_OFFSET];
+
+		for(xi=0; xi<(LCD_HORIZONTAL_MAX>>3); xi++)
 		{
-			DisplayBuffer[yi][x_index] |= data_byte;
+			*pucDst++ = *pucSrc++;
 		}
 	}
 
-#ifdef NON_VOLATILE_MEMORY_BUFFER
-	FinishMemoryWrite();
-#endif
+	FrontStale = 0;
 }
+#endif
 
 //*****************************************************************************
 //
-//! Fills a rectangle.
+//! Flushes any cached drawing operations.
 //!
 //! \param pvDisplayData is a pointer to the driver-specific data for this
 //! display driver.
-//! \param pRect is a pointer to the structure describing the rectangle.
-//! \param ulValue is the color of the rectangle.
 //!
-//! This function fills a rectangle on the display.  The coordinates of the
-//! rectangle are assumed to be within the extents of the display, and the
-//! rectangle specification is fully inclusive (in other words, both sXMin and
-//! sXMax are drawn, along with sYMin and sYMax).
+//!
+//! This functions flushes any cached drawing operations to the display.  This
+//! is useful when a local frame buffer is used for drawing operations, and the
+//! flush would copy the local frame buffer to the display.
+//!
+//! Only the rows marked dirty since the previous flush are sent, using the
+//! panel's multiple line write mode. If no row has changed, nothing is sent.
+//!
+//! With USE_SPI_TX_QUEUE defined this function only queues the transfer and
+//! returns immediately. The flush callback is called once the chip select has
+//! been released. If a flush is already running, the request is remembered
+//! and Sharp96x96_RunPendingFlush makes another pass over the dirty rows once
+//! the current one has completed. If the queue is full, the transfer is queued when the next LCD
+//! transaction completes.
+//!
+//! With DOUBLE_BUFFER defined the buffer drawn so far becomes the front
+//! buffer which is sent, and drawing continues in the other one. A flush
+//! still running at this point is waited for first, in LPM0. When called with
+//! interrupts disabled, the request is remembered instead, as above. This
+//! function must not be called from an interrupt handler, which could find
+//! the primitives halfway through drawing into the buffer it swaps.
 //!
 //! \return None.
 //
 //*****************************************************************************
-static void Sharp96x96_RectFill(void *pvDisplayData, const tRectangle *pRect,
-                                  uint16_t ulValue)
+void Sharp96x96_Flush (void *pvDisplayData)
 {
-#ifdef ROTATE_90
-	// Make a new rectangle with transposed coordinates
-	tRectangle tempRect = *pRect;
+	int16_t xj = 0;
+#ifndef USE_SPI_TX_QUEUE
+	//image update mode(1X000000b)
+	uint8_t command = SHARP_LCD_CMD_WRITE_LINE;
+	const uint8_t *pucBlock;
+	uint16_t uiLength;
+	uint16_t xi;
+#endif
 
-	tempRect.sXMin = pRect->sYMin;
-	tempRect.sXMax = pRect->sYMax;
-	tempRect.sYMin = LCD_HORIZONTAL_MAX - pRect->sXMax - 1;
-	tempRect.sYMax = LCD_HORIZONTAL_MAX - pRect->sXMin - 1;
+	DrainTile();
 
-	// Set the pointer to the rectangle to the transposed version
-	pRect = &tempRect;
+#ifdef DOUBLE_BUFFER
+#ifdef USE_SPI_TX_QUEUE
+	// The front buffer cannot be swapped while it is still being sent. If
+	// the flush cannot be waited for, leave it to Sharp96x96_RunPendingFlush.
+	if(!Sharp96x96_WaitForFlush())
+	{
+		FlushPending = 1;
+		return;
+	}
+#endif
+#elif defined(USE_SPI_TX_QUEUE)
+	if(FlushBusy)
+	{
+		FlushPending = 1;
+		return;
+	}
 #endif
 
-	volatile uint16_t xi = 0;
-	volatile uint16_t yi = 0;
-	volatile uint16_t x_index_min = pRect->sXMin>>3;
-	volatile uint16_t x_index_max = pRect->sXMax>>3;
-	volatile uint8_t *pucData, ucfirst_x_byte, uclast_x_byte;
-
-#ifdef NON_VOLATILE_MEMORY_BUFFER
-	PrepareMemoryWrite();
+#ifdef USE_SPI_TX_QUEUE
+	FlushPending = 0;
 #endif
 
-	//calculate first byte
-	//mod by 8 and shift this # bits
-	ucfirst_x_byte = (0xFF >> (pRect->sXMin & 0x7));  
+	//check whether any row needs to be sent at all
+	for(xj=0; xj<(LCD_VERTICAL_MAX>>3); xj++)
+	{
+		if(DirtyLines[xj])
+			break;
+	}
 
-	//calculate last byte
-	//mod by 8 and shift this # bits
-	uclast_x_byte = (0xFF << (7-(pRect->sXMax & 0x7)));   
+	if(xj == (LCD_VERTICAL_MAX>>3))
+	{
+		Sharp96x96_FlushByteCount = 0;
+#ifdef USE_SPI_TX_QUEUE
+		if(FlushCallback)
+			FlushCallback();
+#endif
+		return;
+	}
 
-	//check if more than one data byte
-	if(x_index_min != x_index_max){
+#ifdef DOUBLE_BUFFER
+	Sharp96x96_SwapBuffers();
+#endif
 
-		//write bytes
-		for (yi = pRect->sYMin; yi<= pRect->sYMax; yi++)
-		{
-			//set buffer to correct location
-			pucData = &DisplayBuffer[yi][x_index_min];
+	FlushLine = 0;
+	FlushBytes = 1;
 
-			//black pixels (clear bits)
-			if(ClrBlack == ulValue)
-			{
-				//write first byte
-				*pucData++ &= ~ucfirst_x_byte;
+#ifdef USE_SPI_TX_QUEUE
+	FlushBusy = 1;
 
-				//write middle bytes
-				for(xi = x_index_min; xi < x_index_max-1; xi++)
-				{
-					*pucData++ = 0x00;
-				}
+	// The command byte is made up once the flush gets into the queue
+	FlushWaiting = 1;
+	Sharp96x96_QueueWaiting();
+#else
+	//COM inversion bit, this command carries any pending VCOM change
+	VCOMPending = 0;
+	command = command^VCOMbit;
 
-				//write last byte
-				*pucData &= ~uclast_x_byte;
-			}
-			//white pixels (set bits)
-			else
-			{
-				//write first byte
-				*pucData++ |= ucfirst_x_byte;
+	LcdBusy = 1;
+	AssertCS();
 
-				//write middle bytes
-				for(xi = x_index_min; xi < x_index_max-1; xi++)
-				{
-					*pucData++ = 0xFF;
-				}
+	WriteCmdData(command);
 
-				//write last byte
-				*pucData |= uclast_x_byte;
-			}
-		}
-	}
-	//only one data byte
-	else
+	while((uiLength = Sharp96x96_NextTransfer(&pucBlock)) != 0)
 	{
-		//calculate value of single byte
-		ucfirst_x_byte &= uclast_x_byte;
-
-		//set buffer to correct location
-		pucData = &DisplayBuffer[pRect->sYMin][x_index_min];
-
-		//black pixels (clear bits)
-		if(ClrBlack == ulValue)
-		{
-			*pucData++ &= ~ucfirst_x_byte;
-		}
-		//white pixels (set bits)
-		else
+		for(xi=0; xi<uiLength; xi++)
 		{
-			*pucData++ |= ucfirst_x_byte;
+			WriteCmdData(pucBlock[xi]);
 		}
 	}
 
-#ifdef NON_VOLATILE_MEMORY_BUFFER
-	FinishMemoryWrite();
+	// Wait for last byte to be sent, then drop SCS
+	WaitUntilLcdWriteFinished();
+
+    // Ensure a 2us min delay to meet the LCD's thSCS
+    __delay_cycles(SYSTEM_CLOCK_SPEED * 0.000002);
+
+	DeassertCS();
+	LcdBusy = 0;
+
+	Sharp96x96_FlushByteCount = FlushBytes;
+
+	// VCOM changed while the bus was busy
+	if(VCOMPending)
+		Sharp96x96_SendToggleVCOMCommand();
 #endif
 }
 
+#ifdef USE_SPI_TX_QUEUE
 //*****************************************************************************
 //
-//! Translates a 24-bit RGB color to a display driver-specific color.
-//!
-//! \param pvDisplayData is a pointer to the driver-specific data for this
-//! display driver.
-//! \param ulValue is the 24-bit RGB color.  The least-significant byte is the
-//! blue channel, the next byte is the green channel, and the third byte is the
-//! red channel.
+//! Completes a queued flush.
 //!
-//! This function translates a 24-bit RGB color into a value that can be
-//! written into the display's frame buffer in order to reproduce that color,
-//! or the closest possible approximation of that color.
+//! Called from the USCI_B0 interrupt once the chip select has been released.
+//! A flush requested while this one was running is not started from here:
+//! scanning the dirty rows and swapping the buffers would race with drawing
+//! in progress, and copying rows would hold up the audio interrupt. The flush
+//! callback lets the main loop start it with Sharp96x96_RunPendingFlush.
 //!
-//! \return Returns the display-driver specific color.
+//! \return None.
 //
 //*****************************************************************************
-static uint32_t Sharp96x96_ColorTranslate(void *pvDisplayData,
-                                          uint32_t ulValue)
+static void Sharp96x96_FlushDone(void)
 {
-    //
-    // Translate from a 24-bit RGB color to mono color.
-    //
-    return(DPYCOLORTRANSLATE(ulValue));
-}
+	Sharp96x96_FlushByteCount = FlushBytes;
+	FlushBusy = 0;
+
+	// A clear screen asked for while the queue was full
+	Sharp96x96_QueueWaiting();
 
+	if(FlushCallback)
+	{
+		FlushCallback();
+	}
+
+	// VCOM changed after the command byte of this flush was sent
+	if(VCOMPending)
+		Sharp96x96_SendToggleVCOMCommand();
+}
 
 //*****************************************************************************
 //
-//! Flushes any cached drawing operations.
+//! Completes a queued command.
 //!
-//! \param pvDisplayData is a pointer to the driver-specific data for this
-//! display driver.
+//! Called from the USCI_B0 interrupt once the chip select has been released,
+//! which frees a place in the queue for a flush or clear screen still
+//! waiting for one.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void Sharp96x96_CommandDone(void)
+{
+	Sharp96x96_QueueWaiting();
+}
+
+//*****************************************************************************
+//
+//! Queues the flush and clear screen commands waiting for a place.
 //!
+//! Only LCD transactions use the queue they go in, so while it is full an LCD
+//! transaction is always on its way, and its completion calls this function
+//! again. The commands are queued in the order they were asked for, each
+//! carrying the VCOM state current at that time.
 //!
-//! This functions flushes any cached drawing operations to the display.  This
-//! is useful when a local frame buffer is used for drawing operations, and the
-//! flush would copy the local frame buffer to the display.
+//! This function may be called from thread or interrupt context.
 //!
 //! \return None.
 //
 //*****************************************************************************
-void Sharp96x96_Flush (void *pvDisplayData)
+static void Sharp96x96_QueueWaiting(void)
 {
-	uint8_t *pucData = &DisplayBuffer[0][0];
-	int32_t xi =0;
-	int32_t xj = 0;
-	//image update mode(1X000000b)
-	uint8_t command = SHARP_LCD_CMD_WRITE_LINE;
-
-	//COM inversion bit
-	command = command^VCOMbit;
+	unsigned short state = __get_interrupt_state();
 
-	AssertCS();
+	__disable_interrupt();
 
-	WriteCmdData(command);
-	flagSendToggleVCOMCommand = SHARP_SKIP_TOGGLE_VCOM_COMMAND;
-#ifdef LANDSCAPE
-	for(xj=0; xj<LCD_VERTICAL_MAX; xj++)
+	if(ClearWaiting && (ClearFirst || !FlushWaiting))
+	{
+		if(!Sharp96x96_QueueCommand(SHARP_LCD_CMD_CLEAR_SCREEN^VCOMbit,
+				Sharp96x96_CommandDone))
 		{
-		  WriteCmdData(reverse(xj + 1));
+			__set_interrupt_state(state);
+			return;
+		}
+		ClearWaiting = 0;
+		VCOMPending = 0;
+	}
 
-		  for(xi=0; xi<(LCD_HORIZONTAL_MAX>>3); xi++)
-		  {
-			WriteCmdData(*(pucData++));
-		  }
-		  WriteCmdData(SHARP_LCD_TRAILER_BYTE);
+	if(FlushWaiting)
+	{
+		// The flush may be preempted between lines, which are whole wire
+		// packets
+		FlushCommand = SHARP_LCD_CMD_WRITE_LINE^VCOMbit;
+		if(!Sharp96x96_QueueStream(&FlushCommand, 1, Sharp96x96_NextTransfer,
+				Sharp96x96_FlushDone, LCD_LINE_PACKET))
+		{
+			__set_interrupt_state(state);
+			return;
 		}
+		FlushWaiting = 0;
+		VCOMPending = 0;
+	}
 
+	if(ClearWaiting)
+	{
+		if(Sharp96x96_QueueCommand(SHARP_LCD_CMD_CLEAR_SCREEN^VCOMbit,
+				Sharp96x96_CommandDone))
+		{
+			ClearWaiting = 0;
+			VCOMPending = 0;
+		}
+	}
 
-#endif
-#ifdef LANDSCAPE_FLIP
-	pucData = &DisplayBuffer[LCD_VERTICAL_MAX-1][(LCD_HORIZONTAL_MAX>>3)-1];
+	__set_interrupt_state(state);
+}
 
-	for(xj=1; xj<=LCD_VERTICAL_MAX; xj++)
+//*****************************************************************************
+//
+//! Starts a flush that was requested while another one was running.
+//!
+//! Must be called from thread context, typically once the flush callback has
+//! signalled the end of the previous flush. Does nothing if no flush is
+//! waiting or one is still running.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Sharp96x96_RunPendingFlush(void)
+{
+	if(FlushPending && !FlushBusy)
 	{
-		WriteCmdData(reverse(xj));
+		Sharp96x96_Flush(g_sharp96x96LCD.displayData);
+	}
+}
+
+//*****************************************************************************
+//
+//! Returns whether a queued flush is still in progress.
+//!
+//! \return Returns 1 while the panel is being written, 0 otherwise.
+//
+//*****************************************************************************
+uint8_t Sharp96x96_IsFlushBusy(void)
+{
+	return FlushBusy;
+}
+
+//*****************************************************************************
+//
+//! Waits in LPM0 until a queued flush has completed.
+//!
+//! The interrupt state is restored on return. When called with interrupts
+//! disabled, for instance from an interrupt handler, the flush could never
+//! complete, so this function returns without waiting.
+//!
+//! \return Returns 1 if no flush is in progress, 0 if one was not waited for.
+//
+//*****************************************************************************
+uint8_t Sharp96x96_WaitForFlush(void)
+{
+	unsigned short state = __get_interrupt_state();
 
-	  for(xi=0; xi < (LCD_HORIZONTAL_MAX>>3); xi++)
-	  {
-		WriteCmdData(reverse(*pucData--));
-	  }
-	  WriteCmdData(SHARP_LCD_TRAILER_BYTE);
+	if(!(state & GIE))
+	{
+		return !FlushBusy;
 	}
-#endif
 
-	WriteCmdData(SHARP_LCD_TRAILER_BYTE);
+	__disable_interrupt();
 
-	// Wait for last byte to be sent, then drop SCS
-	WaitUntilLcdWriteFinished();
+	while(FlushBusy)
+	{
+		// GIE is set together with LPM0, so the interrupt ending the flush
+		// cannot slip in between the check and going to sleep
+		__bis_SR_register(LPM0_bits | GIE);
+		__disable_interrupt();
+	}
 
-    // Ensure a 2us min delay to meet the LCD's thSCS
-    __delay_cycles(SYSTEM_CLOCK_SPEED * 0.000002);
+	__set_interrupt_state(state);
+	return 1;
+}
 
-	DeassertCS();
+//*****************************************************************************
+//
+//! Registers a function to be called when a queued flush completes.
+//!
+//! \param pfnCallback is the function to call, or 0 for none. It is called
+//! from interrupt context once the chip select has been released, so it
+//! must be short.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Sharp96x96_SetFlushCallback(void (*pfnCallback)(void))
+{
+	FlushCallback = pfnCallback;
 }
+#endif
 
 //*****************************************************************************
 //
@@ -600,15 +3129,31 @@ void Sharp96x96_Flush (void *pvDisplayData)
 //*****************************************************************************
 void Sharp96x96_ClearScreen (void *pvDisplayData, uint16_t ulValue)
 {
+#ifdef USE_SPI_TX_QUEUE
+	unsigned short state = __get_interrupt_state();
+
+	// Queued behind any running or waiting flush, so the panel still ends up
+	// cleared. If the queue is full, the next LCD transaction to complete
+	// queues it.
+	__disable_interrupt();
+	if(!ClearWaiting)
+	{
+		ClearWaiting = 1;
+		ClearFirst = !FlushWaiting;
+	}
+	__set_interrupt_state(state);
+	Sharp96x96_QueueWaiting();
+#else
 	//clear screen mode(0X100000b)
 	uint8_t command = SHARP_LCD_CMD_CLEAR_SCREEN;
-	//COM inversion bit
+	//COM inversion bit, this command carries any pending VCOM change
+	VCOMPending = 0;
 	command = command^VCOMbit;
 
+	LcdBusy = 1;
 	AssertCS();
 
 	WriteCmdData(command);
-	flagSendToggleVCOMCommand = SHARP_SKIP_TOGGLE_VCOM_COMMAND;
 	WriteCmdData(SHARP_LCD_TRAILER_BYTE);
 
 	// Wait for last byte to be sent, then drop SCS
@@ -618,49 +3163,124 @@ void Sharp96x96_ClearScreen (void *pvDisplayData, uint16_t ulValue)
 	__delay_cycles(SYSTEM_CLOCK_SPEED * 0.000002);
 
 	DeassertCS();
+	LcdBusy = 0;
+
+	// VCOM changed while the bus was busy
+	if(VCOMPending)
+		Sharp96x96_SendToggleVCOMCommand();
+#endif
+	// Rows still waiting in the tile would be cleared anyway
+	DiscardTile();
+
 	if(ClrBlack == ulValue)
 	Sharp96x96_InitializeDisplayBuffer(pvDisplayData, SHARP_BLACK);
 	else
 	Sharp96x96_InitializeDisplayBuffer(pvDisplayData, SHARP_WHITE);
 
+#ifdef DOUBLE_BUFFER
+	// The front buffer may still be being sent, ahead of the clear command,
+	// so it is left alone. It becomes the back buffer on the next flush,
+	// which brings all of it up to date then.
+	FrontStale = 1;
+#endif
+
+	// The clear command leaves the panel white, so only a black buffer
+	// still differs from what is shown
+	if(ClrBlack == ulValue)
+	Sharp96x96_SetAllLines(0xFF);
+	else
+	Sharp96x96_SetAllLines(0x00);
+
+}
+
+#ifndef USE_EXTCOMIN
+//*****************************************************************************
+//
+//! Advances the software VCOM timing.
+//!
+//! This function is called from the Timer A1 interrupt, VCOM_TICKS_PER_TOGGLE
+//! times per VCOM half period. On the first tick of a half period VCOMbit is
+//! toggled, which the next flush or clear command carries to the panel. On
+//! the last tick the VCOM command is sent on its own if no such command has
+//! gone out in the meantime. The SPI bus is only used through the transaction
+//! queue, or when no blocking transfer is in progress.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Sharp96x96_VCOMTick(void)
+{
+	if(++VCOMPhase >= VCOM_TICKS_PER_TOGGLE)
+	{
+		VCOMPhase = 0;
+	}
+
+	if(1 == VCOMPhase)
+	{
+		VCOMbit ^= SHARP_VCOM_TOGGLE_BIT;
+		VCOMPending = 1;
+	}
+	else if((0 == VCOMPhase) && VCOMPending)
+	{
+		Sharp96x96_SendToggleVCOMCommand();
+	}
 }
+#endif
 
 //*****************************************************************************
 //
 //! Send toggle VCOM command.
 //!
-//! This function toggles the state of VCOM which prevents a DC bias from being 
-//! built up within the panel.
+//! This function sends the current VCOM state to the panel, which prevents a
+//! DC bias from being built up within the panel. Nothing is sent when the bus
+//! is in use by a flush; the end of that flush calls this function again.
 //!
 //! \return None.
 //
 //*****************************************************************************
 void Sharp96x96_SendToggleVCOMCommand()
 {
-	VCOMbit ^= SHARP_VCOM_TOGGLE_BIT;
+	//change VCOM mode(0X000000b)
+	uint8_t command = SHARP_LCD_CMD_CHANGE_VCOM;
+
+#ifdef USE_SPI_TX_QUEUE
+	if(FlushBusy)
+	{
+		return;
+	}
+
+	//COM inversion bit
+	VCOMPending = 0;
+	command = command^VCOMbit;
 
-	if(SHARP_SEND_TOGGLE_VCOM_COMMAND == flagSendToggleVCOMCommand)
+	// If the queue is full, try again on the next tick or flush
+	if(!Sharp96x96_QueueCommand(command, Sharp96x96_CommandDone))
 	{
-		//clear screen mode(0X100000b)
-		uint8_t command = SHARP_LCD_CMD_CHANGE_VCOM;
-		//COM inversion bit
-		command = command^VCOMbit;
+		VCOMPending = 1;
+	}
+#else
+	if(LcdBusy)
+	{
+		return;
+	}
 
-	    AssertCS();
+	//COM inversion bit
+	VCOMPending = 0;
+	command = command^VCOMbit;
 
-		WriteCmdData(command);
-		WriteCmdData(SHARP_LCD_TRAILER_BYTE);
+	AssertCS();
 
-		// Wait for last byte to be sent, then drop SCS
-		WaitUntilLcdWriteFinished();
+	WriteCmdData(command);
+	WriteCmdData(SHARP_LCD_TRAILER_BYTE);
 
-		// Ensure a 2us min delay to meet the LCD's thSCS
-		__delay_cycles(SYSTEM_CLOCK_SPEED * 0.000002);
+	// Wait for last byte to be sent, then drop SCS
+	WaitUntilLcdWriteFinished();
 
-		DeassertCS();
-	}
+	// Ensure a 2us min delay to meet the LCD's thSCS
+	__delay_cycles(SYSTEM_CLOCK_SPEED * 0.000002);
 
-	flagSendToggleVCOMCommand = SHARP_SEND_TOGGLE_VCOM_COMMAND;
+	DeassertCS();
+#endif
 }
 
 
@@ -674,6 +3294,8 @@ void Sharp96x96_SendToggleVCOMCommand()
 //!	\param ucValue is the foreground color of the buffered data.
 //!
 //! This function initializes the display buffer and discards any cached data.
+//! With WIRE_FORMAT_BUFFER it also writes the line address and trailer bytes
+//! of every row, so the display must be cleared once before the first flush.
 //!
 //! \return None.
 //
@@ -691,8 +3313,23 @@ static void Sharp96x96_InitializeDisplayBuffer(void *pvDisplayData, uint8_t ucVa
 
 #else
 	for(i =0; i< LCD_VERTICAL_MAX; i++)
-	for(j =0; j< (LCD_HORIZONTAL_MAX>>3); j++)
-		*pucData++ = ucValue;
+	{
+		pucData = (uint8_t *)pvDisplayData + (i * LCD_ROW_STRIDE);
+
+#ifdef WIRE_FORMAT_BUFFER
+		// The line address and trailer are stored along with the row
+		*pucData++ = reverse(i + 1);
+		pucData[LCD_HORIZONTAL_MAX>>3] = SHARP_LCD_TRAILER_BYTE;
+#endif
+
+		for(j =0; j< (LCD_HORIZONTAL_MAX>>3); j++)
+			*pucData++ = ucValue;
+	}
+
+#ifdef WIRE_FORMAT_BUFFER
+	// Trailer which ends a multiple line write reaching the last row
+	*((uint8_t *)pvDisplayData + (LCD_VERTICAL_MAX * LCD_ROW_STRIDE)) = SHARP_LCD_TRAILER_BYTE;
+#endif
 
 #endif //USE_FLASH_BUFFER
 }
@@ -703,7 +3340,11 @@ static void Sharp96x96_InitializeDisplayBuffer(void *pvDisplayData, uint8_t ucVa
 //! sharpLCD panel 
 //
 //*****************************************************************************
+#ifdef DOUBLE_BUFFER
+tDisplay g_sharp96x96LCD =
+#else
 const tDisplay g_sharp96x96LCD =
+#endif
 {
     sizeof(tDisplay),
     DisplayBuffer,
@@ -711,13 +3352,8 @@ const tDisplay g_sharp96x96LCD =
     LCD_VERTICAL_MAX,
     Sharp96x96_PixelDraw, //PixelDraw,
     Sharp96x96_DrawMultiple,
-#ifdef ROTATE_90
-    Sharp96x96_LineDrawV,
-    Sharp96x96_LineDrawH, //LineDrawV,
-#else
     Sharp96x96_LineDrawH,
     Sharp96x96_LineDrawV, //LineDrawV,
-#endif
     Sharp96x96_RectFill, //RectFill,
     Sharp96x96_ColorTranslate,
     Sharp96x96_Flush, //Flush
@@ -46,13 +46,22 @@
 //
 //*****************************************************************************
 
-// SYSTEM_CLOCK_SPEED (in Hz) allows to properly closeout SPI communication
-#define SYSTEM_CLOCK_SPEED      8000000
+// SYSTEM_CLOCK_SPEED (in Hz) allows to properly closeout SPI communication.
+// Must not be below MCLK, see configClocks() in peripherals.c
+#define SYSTEM_CLOCK_SPEED      8388608
 
 // Define LCD Screen Orientation Here
 #define LANDSCAPE
 #define ROTATE_90
 
+// Store each DisplayBuffer row in the panel's wire format (line address, line
+// data, trailer) so a flush sends the buffer as is. Requires LANDSCAPE.
+#define WIRE_FORMAT_BUFFER
+
+// Keep a front and a back DisplayBuffer so drawing the next frame can overlap
+// sending the current one. Comment out to save the RAM of the second buffer.
+#define DOUBLE_BUFFER
+
 //Maximum Colors in an image color palette
 #define MAX_PALETTE_COLORS  2
 
@@ -104,6 +113,22 @@
 // Prototypes for the globals exported by this driver.
 //
 //*****************************************************************************
+#ifdef DOUBLE_BUFFER
+extern tDisplay g_sharp96x96LCD;
+#else
 extern const tDisplay g_sharp96x96LCD;
+#endif
+extern uint16_t Sharp96x96_FlushByteCount;
+extern uint8_t Sharp96x96_IsFlushBusy(void);
+extern uint8_t Sharp96x96_WaitForFlush(void);
+extern void Sharp96x96_RunPendingFlush(void);
+extern void Sharp96x96_SetFlushCallback(void (*pfnCallback)(void));
 extern void Sharp96x96_SendToggleVCOMCommand();
+extern void Sharp96x96_VCOMTick(void);
+extern void Sharp96x96_DrawString(const Graphics_Context *context,
+		const char *pcString, int32_t lLength, int32_t lX, int32_t lY,
+		bool bOpaque);
+extern void Sharp96x96_DrawStringCentered(const Graphics_Context *context,
+		const char *pcString, int32_t lLength, int32_t lX, int32_t lY,
+		bool bOpaque);
 #endif // __SHARPLCD_H__
@@ -0,0 +1,368 @@
+/*
+ * audio.c
+ *
+ * Wavetable synthesis on the MCP4921 DAC, see audio.h.
+ *
+ * The sample interrupt does a fixed amount of work per voice and never waits
+ * on the bus: it queues the DAC write at the high priority of the USCI_B0
+ * arbiter, which sends it from its own interrupts, preempting an LCD flush at
+ * its next line. The guard registered with the arbiter only lets a line start
+ * when it ends early enough for the next sample, which has until the following
+ * LDAC pulse to be sent. By the instruction timings, the voice loop takes
+ * about 42 MCLK cycles for a sounding voice and 11 for a silent one, and the
+ * rest of the interrupt about 230, of which about 100 save and restore MPY32
+ * and 130 are the entry and exit, queueing the write and turning the sum
+ * into a DAC code. Four sounding voices so take about 400 of the 1024 MCLK
+ * cycles of a sample, plus the bus interrupts sending the write. Timer A0 counts SMCLK, half of MCLK, from 0 at each sample, so
+ * reading TA0R as the interrupt ends gives the time it took including its
+ * latency. audioStats() keeps the longest and the total to check this on the
+ * hardware.
+ *
+ * The voices are mixed with the signed multiply and accumulate of MPY32: the
+ * 8 bit sample in the upper byte times an amplitude of up to 4096 leaves
+ * the voice's share of the DAC code in RESHI, and even 8 voices at full
+ * amplitude cannot overflow the 32 bit result. The sum is clamped when it is
+ * turned into a DAC code; MPYSAT is not used as it only catches an overflow
+ * of the last accumulation. Nothing keeps the interrupt from landing in the
+ * middle of a multiplication of the code it interrupts, so it saves the
+ * multiplier's operand, result and control registers first and restores
+ * them when it is done with it.
+ */
+
+#include "audio.h"
+#include "spibus.h"
+#include "timebase.h"
+
+#ifndef USE_SPI_TX_QUEUE
+#error audio.c needs USE_SPI_TX_QUEUE to share UCB0 with the LCD
+#endif
+
+// SMCLK cycles kept free before a DAC write has to be sent, for the interrupt
+// latencies, the chip selects and the 16 bits of the write
+#define AUDIO_BUS_MARGIN    256
+
+typedef struct AudioVoice {
+    const int8_t *wave;     // wavetable played, 0 for a silent voice
+    uint32_t phase;         // position in the wavetable, in 2^-32 periods
+    uint32_t increment;     // phase advance per sample
+    unsigned int amplitude; // up to AUDIO_AMPLITUDE_FULL
+    bool releasing;         // stops at the end of the current period
+    uint8_t priority;       // of the sound played
+    uint8_t sound;          // id of the sound played, see audioPlay()
+} AudioVoice;
+
+static AudioVoice voices[AUDIO_VOICES];
+
+// Id of the next sound played, never 0
+static uint8_t nextSound = 1;
+
+// DAC code of the sample the next interrupt sends
+static unsigned int nextCode = AUDIO_MID_SCALE;
+
+// The DAC write queued by the last interrupt has not been sent yet
+static volatile bool dacBusy = false;
+
+static volatile AudioStats stats;
+static bool running = false;
+
+// Sets up the DAC chip select and LDAC pins and Timer A0. UCB0 and the SPI
+// pins are set up for the LCD by configDisplay(), which has to run first.
+void audioInit(void)
+{
+    DAC_PORT_CS_SEL &= ~DAC_PIN_CS;
+    DAC_PORT_CS_OUT |= DAC_PIN_CS;
+    DAC_PORT_CS_DIR |= DAC_PIN_CS;
+
+    // with LDAC high, the output only changes on its falling edge
+    DAC_PORT_LDAC_SEL &= ~DAC_PIN_LDAC;
+    DAC_PORT_LDAC_OUT |= DAC_PIN_LDAC;
+    DAC_PORT_LDAC_DIR |= DAC_PIN_LDAC;
+
+    TA0CTL = TASSEL__SMCLK + MC__STOP + TACLR;
+    TA0CCTL0 = 0;
+    TA0CCR0 = AUDIO_TIMER_TICKS - 1;
+
+    timeSmclkUser(audioRunning);
+}
+
+// Called by the bus once the DAC write has been sent
+static void dacDone(void)
+{
+    dacBusy = false;
+}
+
+// Bus guard: lets the LCD take the bus for a number of SMCLK cycles only if
+// the DAC write due by the next LDAC pulse can still be sent after them. The
+// write queued at the next interrupt has until the one after to be sent.
+static bool audioBusGuard(uint16_t ticks)
+{
+    return TA0R + ticks + AUDIO_BUS_MARGIN <= 2 * AUDIO_TIMER_TICKS;
+}
+
+// Starts the sample interrupt, from mid scale with every voice silent
+void audioStart(void)
+{
+    uint8_t i;
+
+    audioStop();
+
+    for (i = 0; i < AUDIO_VOICES; i++) {
+        voices[i].wave = 0;
+    }
+    nextCode = AUDIO_MID_SCALE;
+    stats.samples = 0;
+    stats.busy = 0;
+    stats.missed = 0;
+    stats.maxTicks = 0;
+
+    dacBusy = false;
+    spiBusSetGuard(audioBusGuard);
+
+    running = true;
+    TA0CCTL0 = CCIE;
+    TA0CTL = TASSEL__SMCLK + MC__UP + TACLR;
+}
+
+// Stops the sample interrupt. The DAC keeps its last sample.
+void audioStop(void)
+{
+    TA0CTL = TASSEL__SMCLK + MC__STOP;
+    TA0CCTL0 = 0;
+    running = false;
+    spiBusSetGuard(0);
+}
+
+// Returns true while the sample interrupt runs, which needs SMCLK
+bool audioRunning(void)
+{
+    return running;
+}
+
+// Picks the voice for a new sound of a priority: a silent voice, or else the
+// voice of the lowest priority sound, a releasing one and then the oldest one
+// first. Returns 0 if every sound playing has a higher priority.
+static AudioVoice *pickVoice(uint8_t priority)
+{
+    AudioVoice *v, *best = 0;
+
+    for (v = voices; v < voices + AUDIO_VOICES; v++) {
+        if (v->wave == 0) {
+            return v;
+        }
+        if (v->priority > priority) {
+            continue;
+        }
+        if (best == 0 || v->priority < best->priority) {
+            best = v;
+        }
+        else if (v->priority == best->priority) {
+            if (v->releasing != best->releasing) {
+                if (v->releasing) {
+                    best = v;
+                }
+            }
+            // ids count up, so the older sound is further behind nextSound
+            else if ((uint8_t)(nextSound - v->sound) > (uint8_t)(nextSound - best->sound)) {
+                best = v;
+            }
+        }
+    }
+    return best;
+}
+
+// Plays a MIDI note with a wavetable from wavetable.h at an amplitude of up
+// to AUDIO_AMPLITUDE_FULL, taking a voice from a lower priority sound if
+// they are all busy. A silent voice starts at the beginning of the table; a
+// taken one keeps its phase. Returns the id of the sound for audioRelease(),
+// or 0 if it could not be played.
+uint8_t audioPlay(uint8_t note, const int8_t *wave, unsigned int amplitude,
+                  uint8_t priority)
+{
+    AudioVoice *v;
+    uint8_t sound;
+    unsigned short state;
+
+    if (note < WAVE_NOTE_LOWEST || note > WAVE_NOTE_HIGHEST) {
+        return 0;
+    }
+    if (amplitude > AUDIO_AMPLITUDE_FULL) {
+        amplitude = AUDIO_AMPLITUDE_FULL;
+    }
+
+    state = __get_interrupt_state();
+    __disable_interrupt();
+
+    v = pickVoice(priority);
+    if (v == 0) {
+        __set_interrupt_state(state);
+        return 0;
+    }
+
+    sound = nextSound++;
+    if (nextSound == 0) {
+        nextSound = 1;
+    }
+
+    if (v->wave == 0) {
+        v->phase = 0;
+    }
+    v->increment = wavePhaseIncrements[note - WAVE_NOTE_LOWEST];
+    v->amplitude = amplitude;
+    v->wave = wave;
+    v->releasing = false;
+    v->priority = priority;
+    v->sound = sound;
+
+    __set_interrupt_state(state);
+    return sound;
+}
+
+// Stops a sound at the end of its current period, where the wavetable is back
+// at 0, so it does not click. Does nothing if its voice has been taken.
+void audioRelease(uint8_t sound)
+{
+    AudioVoice *v;
+
+    if (sound == 0) {
+        return;
+    }
+    for (v = voices; v < voices + AUDIO_VOICES; v++) {
+        if (v->sound == sound && v->wave) {
+            v->releasing = true;
+        }
+    }
+}
+
+// Copies the interrupt statistics
+void audioStats(AudioStats *copy)
+{
+    unsigned short state = __get_interrupt_state();
+
+    __disable_interrupt();
+    *copy = stats;
+    __set_interrupt_state(state);
+}
+
+// Returns the share of CPU time taken by the sample interrupt since the
+// previous call, in percent, and starts counting again
+unsigned int audioLoadPercent(void)
+{
+    unsigned long samples, busy;
+    unsigned short state = __get_interrupt_state();
+
+    __disable_interrupt();
+    samples = stats.samples;
+    busy = stats.busy;
+    stats.samples = 0;
+    stats.busy = 0;
+    __set_interrupt_state(state);
+
+    if (samples == 0) {
+        return 0;
+    }
+    // scaled down first so busy * 100 cannot overflow
+    while (samples > 0xFFFFUL) {
+        samples >>= 1;
+        busy >>= 1;
+    }
+    return (unsigned int)((busy * 100) / (samples * AUDIO_TIMER_TICKS));
+}
+
+// Timer A0 CCR0 interrupt, once per sample
+#pragma vector=TIMER0_A0_VECTOR
+__interrupt void TIMER0_A0_ISR(void)
+{
+    unsigned int code = nextCode;
+    unsigned int ticks;
+    int sum;
+    AudioVoice *v;
+    uint32_t phase;
+    unsigned int mpyCtl, mpyOp1Lo, mpyOp1Hi, mpySumExt;
+    unsigned int mpyRes[4];
+
+    // latches the sample sent by the previous interrupt
+    DAC_PORT_LDAC_OUT &= ~DAC_PIN_LDAC;
+    DAC_PORT_LDAC_OUT |= DAC_PIN_LDAC;
+
+    // a write still queued when its sample is latched came too late
+    if (dacBusy) {
+        stats.missed++;
+    }
+    else {
+        dacBusy = spiBusSend(SPI_PRIORITY_HIGH, SPI_DEVICE_DAC,
+                             (DAC_COMMAND | code) >> 8, code & 0xFF, dacDone);
+        if (!dacBusy) {
+            stats.missed++;
+        }
+    }
+
+    // the interrupted code may be halfway through its own multiplication:
+    // keep the operand, result and mode to put back once the voices are mixed
+    mpyCtl = MPY32CTL0;
+    mpyOp1Lo = MPY32L;
+    mpyOp1Hi = MPY32H;
+    mpyRes[0] = RES0;
+    mpyRes[1] = RES1;
+    mpyRes[2] = RES2;
+    mpyRes[3] = RES3;
+    mpySumExt = SUMEXT;
+
+    // works out the next sample while this one is sent, with 16 bit operands
+    // and neither fractional nor saturating results
+    MPY32CTL0 = 0;
+    RESLO = 0;
+    RESHI = 0;
+    for (v = voices; v < voices + AUDIO_VOICES; v++) {
+        if (v->wave) {
+            // the sample's bits moved to the upper byte make it times 256
+            MACS = (unsigned int)(uint8_t)v->wave[(uint8_t)(v->phase >> WAVE_INDEX_SHIFT)] << 8;
+            OP2 = v->amplitude;
+            phase = v->phase + v->increment;
+            if (phase < v->phase && v->releasing) {
+                v->wave = 0;
+            }
+            v->phase = phase;
+        }
+    }
+    sum = (int)RESHI;
+
+    // SUMEXT cannot be written: a multiplication of the same sign or carry
+    // sets it again, then the rest is written back, the mode bits last
+    if (mpySumExt == 0xFFFF) {
+        MPYS = 0xFFFF;
+        OP2 = 1;
+    }
+    else if (mpySumExt) {
+        RESLO = 0xFFFF;
+        RESHI = 0xFFFF;
+        MAC = 1;
+        OP2 = 1;
+    }
+    else {
+        MPY = 0;
+        OP2 = 0;
+    }
+    RES0 = mpyRes[0];
+    RES1 = mpyRes[1];
+    RES2 = mpyRes[2];
+    RES3 = mpyRes[3];
+    MPY32L = mpyOp1Lo;
+    MPY32H = mpyOp1Hi;
+    MPY32CTL0 = mpyCtl;
+    if (sum >= AUDIO_CODE_MAX - AUDIO_MID_SCALE) {
+        nextCode = AUDIO_CODE_MAX;
+    }
+    else if (sum <= -AUDIO_MID_SCALE) {
+        nextCode = 0;
+    }
+    else {
+        nextCode = AUDIO_MID_SCALE + sum;
+    }
+
+    ticks = TA0R;
+    stats.samples++;
+    stats.busy += ticks;
+    if (ticks > stats.maxTicks) {
+        stats.maxTicks = ticks;
+    }
+}
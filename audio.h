@@ -0,0 +1,72 @@
+/*
+ * audio.h
+ *
+ * Wavetable synthesis on the MCP4921 DAC.
+ *
+ * Timer A0 interrupts at AUDIO_SAMPLE_RATE. Each interrupt first pulses LDAC
+ * to latch the sample sent by the previous one, so the output changes at
+ * exactly even intervals whatever the interrupt latency, then queues the next
+ * sample for UCB0 and works out the one after while it is sent.
+ *
+ * Each voice plays a wavetable from flash with a 32 bit phase accumulator:
+ * the phase advances by the note's phase increment every sample and its top
+ * 8 bits index the table. The samples are scaled by the voice amplitudes and
+ * summed on the MPY32 multiplier, then clamped to the 12 bit DAC range
+ * around mid scale.
+ *
+ * A sound is started with a priority. When every voice is busy it takes the
+ * voice of the lowest priority sound, releasing sounds and then the oldest
+ * first, as long as that priority is not above its own.
+ *
+ * UCB0 is shared with the LCD through the arbiter in spibus.h. The DAC writes
+ * go first and preempt an LCD flush between two lines, so a sample is only
+ * lost if its write has still not been sent when it is due to be latched. The
+ * DAC then keeps the previous sample; audioStats() counts them.
+ */
+
+#ifndef AUDIO_H_
+#define AUDIO_H_
+
+#include <msp430.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "peripherals.h"
+#include "wavetable.h"
+
+// Sample rate in Hz, and Timer A0 period in SMCLK cycles
+#define AUDIO_SAMPLE_RATE   WAVE_SAMPLE_RATE
+#define AUDIO_TIMER_TICKS   (SMCLK_HZ / AUDIO_SAMPLE_RATE)
+
+// Number of voices sounding at once, at most 8
+#define AUDIO_VOICES        4
+
+// Amplitude of a voice filling the whole DAC range on its own. Louder voices
+// together are clamped to the range.
+#define AUDIO_AMPLITUDE_FULL    4096
+#define AUDIO_MID_SCALE         2048
+#define AUDIO_CODE_MAX          4095
+
+// MCP4921 command bits: DAC A, unbuffered reference, 1x gain, output on
+#define DAC_COMMAND         0x3000
+
+// CPU cost of the sample interrupt since audioStart(); samples and busy also
+// restart at every audioLoadPercent() call
+typedef struct AudioStats {
+    unsigned long samples;  // samples due
+    unsigned long busy;     // SMCLK cycles spent in the interrupt over them
+    unsigned int missed;    // samples not sent before they were latched
+    unsigned int maxTicks;  // longest interrupt, in SMCLK cycles
+} AudioStats;
+
+// Prototypes for functions implemented in audio.c
+void audioInit(void);
+void audioStart(void);
+void audioStop(void);
+bool audioRunning(void);
+uint8_t audioPlay(uint8_t note, const int8_t *wave, unsigned int amplitude,
+                  uint8_t priority);
+void audioRelease(uint8_t sound);
+void audioStats(AudioStats *stats);
+unsigned int audioLoadPercent(void);
+
+#endif /* AUDIO_H_ */
@@ -0,0 +1,154 @@
+/*
+ * buttons.c
+ *
+ * Debounced push buttons, see buttons.h.
+ */
+
+#include "buttons.h"
+#include "events.h"
+
+// Debounced state of the buttons, a set bit is a pressed button
+static volatile uint8_t buttonState = 0;
+
+// Vertical counter: bit n of count1 and count0 is a 2 bit count of the
+// samples in a row in which button n has differed from its debounced state
+static uint8_t count0 = 0;
+static uint8_t count1 = 0;
+
+// Single producer, single consumer queue of edges. The sampler only writes
+// the entries and edgeHead, buttonGetEdge only edgeTail, and single byte
+// writes are atomic, so neither side has to disable interrupts.
+static volatile ButtonEdge edgeQueue[BUTTON_QUEUE_SIZE];
+static volatile uint8_t edgeHead = 0;
+static volatile uint8_t edgeTail = 0;
+
+// Sets P2.2, P3.6, P7.0 and P7.4 to inputs with pull ups
+void buttonsInit(void)
+{
+    P2SEL &= ~BIT2;
+    P3SEL &= ~BIT6;
+    P7SEL &= ~(BIT0 | BIT4);
+
+    P2DIR &= ~BIT2;
+    P3DIR &= ~BIT6;
+    P7DIR &= ~(BIT0 | BIT4);
+
+    P2REN |= BIT2;
+    P3REN |= BIT6;
+    P7REN |= (BIT0 | BIT4);
+
+    P2OUT |= BIT2;
+    P3OUT |= BIT6;
+    P7OUT |= (BIT0 | BIT4);
+}
+
+// Returns the raw state of the buttons, a set bit is a button held down
+uint8_t buttonsRead(void)
+{
+    uint8_t state = 0;
+
+    if ((P7IN & BIT0) == 0) {
+        state |= BUTTON_1;
+    }
+    if ((P3IN & BIT6) == 0) {
+        state |= BUTTON_2;
+    }
+    if ((P2IN & BIT2) == 0) {
+        state |= BUTTON_3;
+    }
+    if ((P7IN & BIT4) == 0) {
+        state |= BUTTON_4;
+    }
+    return state;
+}
+
+// Debounces one sample of all buttons and queues the edges. Runs from the
+// Timer A2 interrupt. Returns true to wake the main loop when the queue gets
+// its first edge.
+static bool buttonsSample(unsigned long sampleTime)
+{
+    uint8_t delta = buttonsRead() ^ buttonState;
+    uint8_t toggle, button;
+    bool wasEmpty = (edgeHead == edgeTail);
+
+    // counts up while a button differs and restarts when it agrees again;
+    // a button toggles when its count wraps from 3 to 0
+    count1 = (count1 ^ count0) & delta;
+    count0 = ~count0 & delta;
+    toggle = delta & ~(count0 | count1);
+
+    if (toggle == 0) {
+        return false;
+    }
+    buttonState ^= toggle;
+
+    // the new level was first seen BUTTON_DEBOUNCE_SAMPLES - 1 samples ago
+    sampleTime -= (BUTTON_DEBOUNCE_SAMPLES - 1) * BUTTON_SAMPLE_TICKS;
+
+    for (button = BUTTON_1; button & BUTTON_ALL; button <<= 1) {
+        volatile ButtonEdge *edge;
+
+        if ((toggle & button) == 0) {
+            continue;
+        }
+        // a full queue drops the edge; the debounced state stays right
+        if ((uint8_t)(edgeHead - edgeTail) == BUTTON_QUEUE_SIZE) {
+            break;
+        }
+        edge = &edgeQueue[edgeHead & (BUTTON_QUEUE_SIZE - 1)];
+        edge->button = button;
+        edge->pressed = (buttonState & button) != 0;
+        edge->time = sampleTime;
+        edgeHead++;
+    }
+
+    if (wasEmpty) {
+        eventPost(EVENT_BUTTON, 0);
+        return true;
+    }
+    return false;
+}
+
+// Starts sampling the buttons, with the current state as debounced state and
+// an empty queue
+void buttonsStart(void)
+{
+    buttonsStop();
+
+    buttonState = buttonsRead();
+    count0 = 0;
+    count1 = 0;
+    edgeTail = edgeHead;
+
+    timeSamplerStart(BUTTON_SAMPLER, BUTTON_SAMPLE_TICKS, buttonsSample);
+}
+
+// Stops sampling the buttons
+void buttonsStop(void)
+{
+    timeSamplerStop(BUTTON_SAMPLER);
+}
+
+// Returns the debounced state of the buttons, a set bit is a button held down
+uint8_t buttonsDown(void)
+{
+    return buttonState;
+}
+
+// Takes the oldest edge out of the queue. Returns false if it is empty.
+bool buttonGetEdge(ButtonEdge *edge)
+{
+    volatile ButtonEdge *entry;
+
+    if (edgeTail == edgeHead) {
+        return false;
+    }
+
+    entry = &edgeQueue[edgeTail & (BUTTON_QUEUE_SIZE - 1)];
+    edge->button = entry->button;
+    edge->pressed = entry->pressed;
+    edge->time = entry->time;
+    edgeTail++;
+
+    return true;
+}
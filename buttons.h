@@ -0,0 +1,51 @@
+/*
+ * buttons.h
+ *
+ * Debounced push buttons on P7.0, P3.6, P2.2 and P7.4.
+ *
+ * Only P1 and P2 have port interrupts, so the buttons are sampled from a
+ * Timer A2 sampler instead. A vertical counter debounces all four buttons at
+ * once, and every press and release is put into a queue together with the
+ * time it happened at.
+ */
+
+#ifndef BUTTONS_H_
+#define BUTTONS_H_
+
+#include <msp430.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "timebase.h"
+
+// Button bits, in the order of the LEDs above them
+#define BUTTON_1    BIT0    // P7.0
+#define BUTTON_2    BIT1    // P3.6
+#define BUTTON_3    BIT2    // P2.2
+#define BUTTON_4    BIT3    // P7.4
+#define BUTTON_ALL  (BUTTON_1 | BUTTON_2 | BUTTON_3 | BUTTON_4)
+
+// Sampling period in ACLK ticks (1024 Hz) and the Timer A2 sampler used
+#define BUTTON_SAMPLE_TICKS     32
+#define BUTTON_SAMPLER          0
+
+// A button has to read the same this many samples in a row to change state
+#define BUTTON_DEBOUNCE_SAMPLES 4
+
+// Number of edges the queue holds, must be a power of 2
+#define BUTTON_QUEUE_SIZE       16
+
+typedef struct ButtonEdge {
+    uint8_t button;         // the button bit
+    bool pressed;           // true for a press, false for a release
+    unsigned long time;     // time of the first sample at the new level
+} ButtonEdge;
+
+// Prototypes for functions implemented in buttons.c
+void buttonsInit(void);
+void buttonsStart(void);
+void buttonsStop(void);
+uint8_t buttonsRead(void);
+uint8_t buttonsDown(void);
+bool buttonGetEdge(ButtonEdge *edge);
+
+#endif /* BUTTONS_H_ */
@@ -0,0 +1,151 @@
+/*
+ * envelope.c
+ *
+ * ADSR envelopes for the buzzer, see envelope.h.
+ */
+
+#include "envelope.h"
+#include "peripherals.h"
+#include "notetable.h"
+
+// Stages of the envelope
+#define STAGE_OFF       0
+#define STAGE_ATTACK    1
+#define STAGE_DECAY     2
+#define STAGE_SUSTAIN   3
+#define STAGE_RELEASE   4
+
+// Level position in 1/256 levels
+#define POSITION_MAX    ((uint16_t)ENVELOPE_LEVEL_MAX << 8)
+
+// Duty cycle of each level as a fraction of the period, times 65536: asin of
+// the level's share of full amplitude, over pi
+static const uint16_t levelDuties[ENVELOPE_LEVELS] = {
+        0,   673,  1347,  2022,  2699,  3379,  4063,  4751,
+     5445,  6145,  6852,  7567,  8292,  9027,  9775, 10536,
+    11313, 12108, 12924, 13762, 14628, 15526, 16460, 17439,
+    18471, 19570, 20755, 22053, 23515, 25234, 27455, 32768
+};
+
+// TB0CCR5 value of each level for the note sounding
+static uint16_t duties[ENVELOPE_LEVELS];
+static uint16_t dutiesPeriod = 0;   // TB0CCR0 the duties were worked out for
+
+static const Envelope *current;
+static uint8_t stage = STAGE_OFF;
+static uint16_t position;
+
+static SoftTimer envelopeTimer;
+
+static void envelopeTick(SoftTimer *timer);
+
+// Works out the TB0CCR5 value of each level for a TB0CCR0 period
+static void buildDuties(uint16_t period)
+{
+    uint8_t i;
+
+    // the timer counts period + 1 ticks per period
+    for (i = 0; i < ENVELOPE_LEVELS; i++) {
+        duties[i] = (uint16_t)(((unsigned long)period + 1) * levelDuties[i] >> 16);
+    }
+    dutiesPeriod = period;
+}
+
+static void startTicks(void)
+{
+    if (!timerIsActive(&envelopeTimer)) {
+        timerSet(&envelopeTimer, TIME_MS_TO_TICKS(ENVELOPE_TICK_MS),
+                 TIME_MS_TO_TICKS(ENVELOPE_TICK_MS), envelopeTick);
+    }
+}
+
+// Plays a MIDI note on the buzzer with an envelope, which has to stay valid
+// while the note sounds. A note played over one still sounding changes pitch
+// at the next period and attacks from the level already reached, so it
+// carries on legato without a click.
+void envelopeNoteOn(uint8_t note, const Envelope *envelope)
+{
+    const NotePeriod *setting;
+
+    if (note < NOTE_LOWEST || note > NOTE_HIGHEST) {
+        envelopeNoteOff();
+        return;
+    }
+    setting = &notePeriods[note - NOTE_LOWEST];
+
+    if (setting->period != dutiesPeriod) {
+        buildDuties(setting->period);
+    }
+    if (stage == STAGE_OFF) {
+        position = 0;
+    }
+    current = envelope;
+    stage = STAGE_ATTACK;
+
+    BuzzerNote(note);
+    BuzzerSetDuty(duties[position >> 8]);
+    startTicks();
+}
+
+// Releases the note sounding; the buzzer turns off once the level reaches 0
+void envelopeNoteOff(void)
+{
+    if (stage == STAGE_OFF || stage == STAGE_RELEASE) {
+        return;
+    }
+    stage = STAGE_RELEASE;
+    startTicks();
+}
+
+// Returns true while a note sounds, including its release
+bool envelopeActive(void)
+{
+    return stage != STAGE_OFF;
+}
+
+// Envelope timer callback, every ENVELOPE_TICK_MS while the level moves
+static void envelopeTick(SoftTimer *timer)
+{
+    uint16_t target;
+
+    switch (stage) {
+    case STAGE_ATTACK:
+        if (current->attack >= POSITION_MAX - position) {
+            position = POSITION_MAX;
+            stage = STAGE_DECAY;
+        }
+        else {
+            position += current->attack;
+        }
+        break;
+
+    case STAGE_DECAY:
+        target = (uint16_t)current->sustain << 8;
+        if (position <= target + current->decay) {
+            position = target;
+            stage = STAGE_SUSTAIN;
+            timerCancel(timer);
+        }
+        else {
+            position -= current->decay;
+        }
+        break;
+
+    case STAGE_RELEASE:
+        if (position <= current->release) {
+            position = 0;
+            stage = STAGE_OFF;
+            timerCancel(timer);
+            BuzzerOff();
+            return;
+        }
+        position -= current->release;
+        break;
+
+    default:
+        timerCancel(timer);
+        return;
+    }
+
+    BuzzerSetDuty(duties[position >> 8]);
+}
@@ -0,0 +1,52 @@
+/*
+ * envelope.h
+ *
+ * ADSR envelopes for the buzzer, by changing the duty cycle of its PWM.
+ *
+ * A square wave's fundamental has an amplitude proportional to sin(pi * d)
+ * for a duty cycle d, so duty cycles from 0 to 50% give every loudness from
+ * silence to full volume at the same pitch. The envelope level goes from 0
+ * to ENVELOPE_LEVEL_MAX in steps of even amplitude. When a note starts, the
+ * TB0CCR5 value of each level is worked out for its period, so a tick of the
+ * envelope is one table lookup and one register write.
+ *
+ * A periodic software timer ticks the envelope every ENVELOPE_TICK_MS while
+ * it attacks, decays or releases; it is stopped while the level holds at
+ * sustain and once the release has ended, when the buzzer is turned off.
+ */
+
+#ifndef ENVELOPE_H_
+#define ENVELOPE_H_
+
+#include <msp430.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "timebase.h"
+
+// Time between envelope ticks
+#define ENVELOPE_TICK_MS        4
+
+// Number of loudness levels
+#define ENVELOPE_LEVELS         32
+#define ENVELOPE_LEVEL_MAX      (ENVELOPE_LEVELS - 1)
+
+// Rate of change of the level that covers the whole range in ms milliseconds,
+// in 1/256 levels per tick. For constants, the division is done by the
+// compiler. Times from 1 to 65535 ms are taken; from about 63.5 s, the
+// slowest rate of 1 is used, which covers the range in 127 s.
+#define ENVELOPE_RATE_UNITS     ((unsigned long)ENVELOPE_LEVEL_MAX * 256 * ENVELOPE_TICK_MS)
+#define ENVELOPE_RATE(ms)       ((uint16_t)((ms) >= 2 * ENVELOPE_RATE_UNITS ? 1 : (ENVELOPE_RATE_UNITS + (ms) / 2) / (ms)))
+
+typedef struct Envelope {
+    uint16_t attack;    // level rise per tick up to ENVELOPE_LEVEL_MAX
+    uint16_t decay;     // level fall per tick down to the sustain level
+    uint8_t sustain;    // level held until the note is released
+    uint16_t release;   // level fall per tick once released, down to 0
+} Envelope;
+
+// Prototypes for functions implemented in envelope.c
+void envelopeNoteOn(uint8_t note, const Envelope *envelope);
+void envelopeNoteOff(void);
+bool envelopeActive(void);
+
+#endif /* ENVELOPE_H_ */
@@ -0,0 +1,89 @@
+/*
+ * events.c
+ *
+ * Event queue for the main loop, see events.h.
+ */
+
+#include "events.h"
+
+// Ring buffer of events. Only eventPost moves the head and only eventGet
+// moves the tail, each with interrupts disabled.
+static Event eventQueue[EVENT_QUEUE_SIZE];
+static volatile uint8_t eventHead = 0;
+static volatile uint8_t eventTail = 0;
+static volatile unsigned int eventsLost = 0;
+
+#define eventCount()    ((uint8_t)(eventHead - eventTail))
+
+// Adds an event to the queue. Safe to call from interrupt service routines.
+// Returns false, and counts the event as dropped, if the queue is full.
+bool eventPost(uint8_t type, uint8_t data)
+{
+    unsigned short state = __get_interrupt_state();
+    Event *event;
+
+    __disable_interrupt();
+    if (eventCount() == EVENT_QUEUE_SIZE) {
+        eventsLost++;
+        __set_interrupt_state(state);
+        return false;
+    }
+
+    event = &eventQueue[eventHead & (EVENT_QUEUE_SIZE - 1)];
+    event->type = type;
+    event->data = data;
+    event->time = timeNow();
+    eventHead++;
+    __set_interrupt_state(state);
+
+    return true;
+}
+
+// Takes the oldest event out of the queue. Returns false if it is empty.
+bool eventGet(Event *event)
+{
+    unsigned short state = __get_interrupt_state();
+
+    __disable_interrupt();
+    if (eventCount() == 0) {
+        __set_interrupt_state(state);
+        return false;
+    }
+
+    *event = eventQueue[eventTail & (EVENT_QUEUE_SIZE - 1)];
+    eventTail++;
+    __set_interrupt_state(state);
+
+    return true;
+}
+
+// Waits for the next event. Software timers are polled while waiting, so
+// their callbacks can post events too. Between events the CPU sleeps until
+// the next timer is due. The queue is checked with interrupts disabled right
+// up to going to sleep, so an event posted by an interrupt is never left
+// waiting for the next wake up.
+void eventWait(Event *event)
+{
+    while (1) {
+        timerPoll();
+
+#ifdef EVENT_BUSY_WAIT
+        if (eventGet(event)) {
+            return;
+        }
+#else
+        __disable_interrupt();
+        if (eventGet(event)) {
+            __enable_interrupt();
+            return;
+        }
+        timeSleepUntil(timerNextWake(timeNow() + EVENT_MAX_SLEEP));
+#endif
+    }
+}
+
+// Returns the number of events lost because the queue was full
+unsigned int eventDropped(void)
+{
+    return eventsLost;
+}
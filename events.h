@@ -0,0 +1,52 @@
+/*
+ * events.h
+ *
+ * Event queue for the main loop.
+ *
+ * Interrupt service routines and software timer callbacks post events, and
+ * the main loop takes them out one at a time with eventWait(), which keeps
+ * the CPU in a low power mode while the queue is empty.
+ */
+
+#ifndef EVENTS_H_
+#define EVENTS_H_
+
+#include <msp430.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "timebase.h"
+
+// Uncomment to make eventWait() poll without ever sleeping, the way the main
+// loop used to run, to compare the CPU duty cycle against
+//#define EVENT_BUSY_WAIT
+
+// Number of events the queue holds, must be a power of 2
+#define EVENT_QUEUE_SIZE    16
+
+// Longest the CPU sleeps for while no software timer is running
+#define EVENT_MAX_SLEEP     (60 * TIME_TICKS_PER_SECOND)
+
+// EVENT TYPES
+enum EventTypes {
+    EVENT_STATE,        // the state machine entered a new state
+    EVENT_TIMER,        // a software timer fired, data is its id
+    EVENT_KEY,          // a keypad key was pressed, data is the key
+    EVENT_KEY_RELEASE,  // a keypad key was released, data is the key
+    EVENT_KEY_LONG,     // a keypad key has been held for a while, data is the key
+    EVENT_BUTTON,       // button edges are waiting, see buttonGetEdge()
+    EVENT_FLUSH_DONE    // the LCD finished sending a flush
+};
+
+typedef struct Event {
+    uint8_t type;           // one of EventTypes
+    uint8_t data;           // meaning depends on the type
+    unsigned long time;     // time the event was posted at, in ACLK ticks
+} Event;
+
+// Prototypes for functions implemented in events.c
+bool eventPost(uint8_t type, uint8_t data);
+bool eventGet(Event *event);
+void eventWait(Event *event);
+unsigned int eventDropped(void);
+
+#endif /* EVENTS_H_ */
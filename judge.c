@@ -0,0 +1,162 @@
+/*
+ * judge.c
+ *
+ * Hit timing judgement, see judge.h.
+ */
+
+#include "judge.h"
+
+// Notes waiting to be judged, a ring buffer per lane in order of time
+typedef struct JudgeLane {
+    unsigned long time[JUDGE_LANE_NOTES];
+    int id[JUDGE_LANE_NOTES];
+    uint8_t head;
+    uint8_t tail;
+} JudgeLane;
+
+static JudgeLane lanes[JUDGE_LANES];
+static JudgeStats stats;
+
+static const char *const judgeNames[] = {"Perfect", "Great", "Good", "Miss!", ""};
+
+// Accuracy points of each grade
+static const uint8_t judgePoints[] = {100, JUDGE_GREAT_POINTS, JUDGE_GOOD_POINTS, 0};
+
+// Counts a judgement in the statistics
+static void judgeCount(uint8_t judgement)
+{
+    stats.count[judgement]++;
+    stats.points += judgePoints[judgement];
+
+    if (judgement == JUDGE_MISS) {
+        stats.combo = 0;
+    }
+    else if (++stats.combo > stats.maxCombo) {
+        stats.maxCombo = stats.combo;
+    }
+}
+
+// Forgets all notes and clears the statistics
+void judgeReset(void)
+{
+    uint8_t lane;
+
+    for (lane = 0; lane < JUDGE_LANES; lane++) {
+        lanes[lane].head = 0;
+        lanes[lane].tail = 0;
+    }
+    stats = (JudgeStats){{0}};
+}
+
+// Adds a note to be hit at time, after the notes already in its lane. id is
+// handed back when the note is hit. Returns false if the lane is full.
+bool judgeAddNote(uint8_t lane, unsigned long time, int id)
+{
+    JudgeLane *l = &lanes[lane];
+    uint8_t slot;
+
+    if ((uint8_t)(l->head - l->tail) == JUDGE_LANE_NOTES) {
+        return false;
+    }
+
+    slot = l->head & (JUDGE_LANE_NOTES - 1);
+    l->time[slot] = time;
+    l->id[slot] = id;
+    l->head++;
+    return true;
+}
+
+// Grades a press against the oldest note of its lane, first grading notes
+// whose window has already passed as misses. Returns JUDGE_NONE if no note
+// is within the Good window; otherwise id is set to the id of the note hit.
+uint8_t judgePress(uint8_t lane, unsigned long time, int *id)
+{
+    JudgeLane *l = &lanes[lane];
+    unsigned long distance;
+    uint8_t slot, judgement;
+
+    while (l->head != l->tail) {
+        slot = l->tail & (JUDGE_LANE_NOTES - 1);
+
+        // the press is before the note: distance is how early
+        if (!timeReached(time, l->time[slot])) {
+            distance = l->time[slot] - time;
+            if (distance > JUDGE_GOOD_WINDOW) {
+                return JUDGE_NONE;
+            }
+            break;
+        }
+
+        distance = time - l->time[slot];
+        if (distance <= JUDGE_GOOD_WINDOW) {
+            break;
+        }
+
+        // too late for this note, which may have been missed unnoticed
+        l->tail++;
+        judgeCount(JUDGE_MISS);
+    }
+
+    if (l->head == l->tail) {
+        return JUDGE_NONE;
+    }
+
+    if (distance <= JUDGE_PERFECT_WINDOW) {
+        judgement = JUDGE_PERFECT;
+    }
+    else if (distance <= JUDGE_GREAT_WINDOW) {
+        judgement = JUDGE_GREAT;
+    }
+    else {
+        judgement = JUDGE_GOOD;
+    }
+
+    *id = l->id[slot];
+    l->tail++;
+    judgeCount(judgement);
+    return judgement;
+}
+
+// Grades every note whose Good window ended before now as a miss. Returns
+// the number of notes missed.
+unsigned int judgeExpire(unsigned long now)
+{
+    unsigned int missed = 0;
+    uint8_t lane;
+
+    for (lane = 0; lane < JUDGE_LANES; lane++) {
+        JudgeLane *l = &lanes[lane];
+
+        while (l->head != l->tail &&
+               !timeReached(l->time[l->tail & (JUDGE_LANE_NOTES - 1)] + JUDGE_GOOD_WINDOW, now)) {
+            l->tail++;
+            judgeCount(JUDGE_MISS);
+            missed++;
+        }
+    }
+    return missed;
+}
+
+// Returns the accuracy of all notes judged so far, in percent
+unsigned int judgeAccuracy(void)
+{
+    unsigned int notes = stats.count[JUDGE_PERFECT] + stats.count[JUDGE_GREAT] +
+                         stats.count[JUDGE_GOOD] + stats.count[JUDGE_MISS];
+
+    if (notes == 0) {
+        return 100;
+    }
+    return (unsigned int)(stats.points / notes);
+}
+
+// Returns the statistics of the notes judged so far
+const JudgeStats *judgeStats(void)
+{
+    return &stats;
+}
+
+// Returns the text shown for a grade
+const char *judgeName(uint8_t judgement)
+{
+    return judgeNames[judgement];
+}
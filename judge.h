@@ -0,0 +1,61 @@
+/*
+ * judge.h
+ *
+ * Hit timing judgement.
+ *
+ * Notes are added ahead of time with the time they should be hit at, one
+ * queue per button lane. Each button press is graded against the oldest
+ * note waiting in its lane, and notes which were never hit are graded as
+ * misses once their Good window has passed. Both take constant time per
+ * note or press, however dense the song.
+ */
+
+#ifndef JUDGE_H_
+#define JUDGE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "timebase.h"
+
+// Lanes, one per button
+#define JUDGE_LANES             4
+
+// Notes each lane can hold ahead of time, must be a power of 2
+#define JUDGE_LANE_NOTES        8
+
+// Largest distance from the note time for each grade, in ACLK ticks. The
+// Good window has to stay under half the time between notes of one lane.
+#define JUDGE_PERFECT_WINDOW    TIME_MS_TO_TICKS(35)
+#define JUDGE_GREAT_WINDOW      TIME_MS_TO_TICKS(70)
+#define JUDGE_GOOD_WINDOW       TIME_MS_TO_TICKS(120)
+
+// Accuracy points of each grade, out of 100 for a Perfect
+#define JUDGE_GREAT_POINTS      75
+#define JUDGE_GOOD_POINTS       50
+
+// GRADES
+enum Judgements {
+    JUDGE_PERFECT,
+    JUDGE_GREAT,
+    JUDGE_GOOD,
+    JUDGE_MISS,
+    JUDGE_NONE          // a press with no note in reach
+};
+
+typedef struct JudgeStats {
+    unsigned int count[JUDGE_MISS + 1];     // notes given each grade
+    unsigned int combo;                     // notes hit in a row
+    unsigned int maxCombo;
+    unsigned long points;                   // accuracy points of all notes
+} JudgeStats;
+
+// Prototypes for functions implemented in judge.c
+void judgeReset(void);
+bool judgeAddNote(uint8_t lane, unsigned long time, int id);
+uint8_t judgePress(uint8_t lane, unsigned long time, int *id);
+unsigned int judgeExpire(unsigned long now);
+unsigned int judgeAccuracy(void);
+const JudgeStats *judgeStats(void);
+const char *judgeName(uint8_t judgement);
+
+#endif /* JUDGE_H_ */
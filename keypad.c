@@ -0,0 +1,218 @@
+/*
+ * keypad.c
+ *
+ * Background scanner for the 3x4 keypad, see keypad.h.
+ */
+
+#include "keypad.h"
+#include "events.h"
+#include "peripherals.h"
+
+// Key number is row * 3 + column
+static const char keyChars[KEYPAD_KEYS] = {
+    '1', '2', '3',
+    '4', '5', '6',
+    '7', '8', '9',
+    '*', '0', '#'
+};
+
+// Rows 2-4, which have port interrupts
+#define interruptRows   (BIT2 | BIT3 | BIT4)
+
+// Keys of column 0 in the rows set in a readRows() value
+static const uint16_t rowKeys[16] = {
+    0x000, 0x001, 0x008, 0x009, 0x040, 0x041, 0x048, 0x049,
+    0x200, 0x201, 0x208, 0x209, 0x240, 0x241, 0x248, 0x249
+};
+
+// Debounced state, bit n set while key n is held
+static volatile uint16_t keyState = 0;
+
+// Vertical counter over the 12 keys, as in buttons.c: a key changes state
+// after differing from it in 4 scans in a row
+static uint16_t count0 = 0;
+static uint16_t count1 = 0;
+
+// Column being driven and the keys seen in the scan so far
+static uint8_t column = 0;
+static uint16_t scanKeys = 0;
+
+// Time each held key was pressed at, and the keys already reported as long
+static unsigned long pressTime[KEYPAD_KEYS];
+static uint16_t longReported = 0;
+
+static bool scanning = false;
+
+// Drives one column low and the others high, or all columns low for 3
+static void driveColumn(uint8_t col)
+{
+    P1OUT |= BIT5;
+    P2OUT |= (BIT5 | BIT4);
+
+    switch (col) {
+    case 0:
+        P1OUT &= ~BIT5;
+        break;
+    case 1:
+        P2OUT &= ~BIT4;
+        break;
+    case 2:
+        P2OUT &= ~BIT5;
+        break;
+    default:
+        P1OUT &= ~BIT5;
+        P2OUT &= ~(BIT5 | BIT4);
+        break;
+    }
+}
+
+// Returns the rows pulled low, bit n for row n + 1
+static uint8_t readRows(void)
+{
+    uint8_t rows = 0;
+
+    if ((P4IN & BIT3) == 0) {
+        rows |= BIT0;
+    }
+    rows |= (~P1IN & interruptRows) >> 1;
+    return rows;
+}
+
+// Starts scanning from the first column
+static void startScan(void)
+{
+    P1IE &= ~interruptRows;
+    scanning = true;
+    column = 0;
+    scanKeys = 0;
+    driveColumn(0);
+}
+
+// Stops scanning with all columns low, so a press on rows 2-4 raises a port
+// interrupt. Returns false if a key is already down again.
+static bool stopScan(void)
+{
+    scanning = false;
+    driveColumn(3);
+
+    P1IES |= interruptRows;
+    P1IFG &= ~interruptRows;
+    P1IE |= interruptRows;
+
+    if (readRows()) {
+        startScan();
+        return false;
+    }
+    return true;
+}
+
+// Posts the events of a finished scan. Returns true if any were posted.
+static bool postKeyEvents(uint16_t toggle, unsigned long sampleTime)
+{
+    bool posted = false;
+    uint16_t bit = 1;
+    uint8_t key;
+
+    for (key = 0; key < KEYPAD_KEYS; key++, bit <<= 1) {
+        if (toggle & bit) {
+            if (keyState & bit) {
+                pressTime[key] = sampleTime;
+                eventPost(EVENT_KEY, keyChars[key]);
+            }
+            else {
+                longReported &= ~bit;
+                eventPost(EVENT_KEY_RELEASE, keyChars[key]);
+            }
+            posted = true;
+        }
+        else if ((keyState & ~longReported & bit) &&
+                 timeReached(sampleTime, pressTime[key] + KEYPAD_LONG_PRESS)) {
+            longReported |= bit;
+            eventPost(EVENT_KEY_LONG, keyChars[key]);
+            posted = true;
+        }
+    }
+    return posted;
+}
+
+// Runs from the Timer A2 interrupt: reads the rows of the driven column and
+// moves on to the next one, debouncing after the last column. While idle it
+// only checks row 1. Returns true to wake the main loop after posting events.
+static bool keypadSample(unsigned long sampleTime)
+{
+    uint16_t delta, toggle;
+    bool posted;
+
+    if (!scanning) {
+        if (readRows()) {
+            startScan();
+            timeSamplerSetPeriod(KEYPAD_SAMPLER, KEYPAD_SCAN_TICKS);
+        }
+        return false;
+    }
+
+    // row n of this column is key 3 * n + column
+    scanKeys |= rowKeys[readRows()] << column;
+
+    if (++column < 3) {
+        driveColumn(column);
+        return false;
+    }
+
+    delta = scanKeys ^ keyState;
+    count1 = (count1 ^ count0) & delta;
+    count0 = ~count0 & delta;
+    toggle = delta & ~(count0 | count1);
+    keyState ^= toggle;
+
+    posted = (toggle || keyState) && postKeyEvents(toggle, sampleTime);
+
+    // nothing held and nothing about to change: wait for a port interrupt
+    if (keyState == 0 && scanKeys == 0 && stopScan()) {
+        timeSamplerSetPeriod(KEYPAD_SAMPLER, KEYPAD_IDLE_TICKS);
+    }
+    else {
+        column = 0;
+        scanKeys = 0;
+        driveColumn(0);
+    }
+
+    return posted;
+}
+
+// Starts the background scan. configKeypad() must have set up the pins.
+void keypadStart(void)
+{
+    keyState = 0;
+    count0 = 0;
+    count1 = 0;
+    longReported = 0;
+
+    startScan();
+    timeSamplerStart(KEYPAD_SAMPLER, KEYPAD_SCAN_TICKS, keypadSample);
+}
+
+// Returns the debounced state of the keys, bit n set while key n is held
+uint16_t keypadDown(void)
+{
+    return keyState;
+}
+
+// Returns the character of key n
+char keypadChar(uint8_t key)
+{
+    return keyChars[key];
+}
+
+// PORT 1 INTERRUPT
+// A key on rows 2-4 was pressed while idle, so scanning starts again
+#pragma vector = PORT1_VECTOR
+__interrupt void Port_1_ISR(void)
+{
+    P1IFG &= ~interruptRows;
+
+    if (!scanning) {
+        startScan();
+        timeSamplerStart(KEYPAD_SAMPLER, KEYPAD_SCAN_TICKS, keypadSample);
+    }
+}
@@ -0,0 +1,45 @@
+/*
+ * keypad.h
+ *
+ * Background scanner for the 3x4 keypad.
+ *
+ * A Timer A2 sampler drives one column per sample and reads the four rows,
+ * so a whole scan takes three samples. Each key is debounced on its own, so
+ * any number of keys can be held at once (without diodes in the matrix, three
+ * keys on the corners of a rectangle also make the fourth look pressed).
+ * Presses, releases and long presses are posted as events.
+ *
+ * While no key is held the scanner drives all columns low and stops scanning.
+ * Rows 2-4 (P1.2-P1.4) then wake it with a port interrupt; row 1 (P4.3) has no
+ * port interrupt, so it is still checked at a slow rate.
+ *
+ * getKey() in peripherals.c must not be used while the scanner is running.
+ */
+
+#ifndef KEYPAD_H_
+#define KEYPAD_H_
+
+#include <msp430.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "timebase.h"
+
+// Time between samples while scanning, in ACLK ticks (1024 Hz), and the Timer
+// A2 sampler used
+#define KEYPAD_SCAN_TICKS       32
+#define KEYPAD_SAMPLER          1
+
+// Time between checks of row 1 while no key is held (32 Hz)
+#define KEYPAD_IDLE_TICKS       1024
+
+// A key held this long also gets an EVENT_KEY_LONG
+#define KEYPAD_LONG_PRESS       TIME_MS_TO_TICKS(1000)
+
+#define KEYPAD_KEYS             12
+
+// Prototypes for functions implemented in keypad.c
+void keypadStart(void);
+uint16_t keypadDown(void);
+char keypadChar(uint8_t key);
+
+#endif /* KEYPAD_H_ */
@@ -4,87 +4,149 @@
 // INCLUDES
 #include <msp430.h>
 #include <stdlib.h>
-#include <math.h>
 #include "peripherals.h"
+#include "timebase.h"
+#include "events.h"
+#include "buttons.h"
+#include "keypad.h"
+#include "judge.h"
+#include "sequencer.h"
+#include "audio.h"
+#include "envelope.h"
 
 // PROTOTYPES
-__interrupt void Timer_A2_ISR(void);
 bool delay(long unsigned int millis);
+bool delayUntil(long unsigned int time);
 void resetTimer();
 void welcome(char key);
 void reset(char key);
 void play(char key);
 void win(void);
 void lose(void);
-void configButtons();
-char buttonStates();
 void configLEDs(char inbits);
 void nextState(int state);
+void stepTimerDone(SoftTimer *timer);
+void flushDone(void);
+void readButtonEdges(void);
+int xAtTick(unsigned long tick);
+void noteOn(int index);
+void noteOff(int index);
+void drawScene();
+void moveSprite(int slot, int x);
+void showJudgement(const char *text);
+int laneOf(char button);
+void showResults(void);
+void drawNumber(char *text, int lastDigit, unsigned int value, int y);
+void eraseStringCentered(const char *string, int x, int y);
+void startSound(unsigned char note);
+void stopSound(void);
+void playMissSound(void);
+void missSoundDone(SoftTimer *timer);
 
 // GLOBALS
 enum States{WELCOME, RESET, PLAY, WIN, LOSE};
 int currentState = RESET;
-long unsigned int currentTime = 0;
-long unsigned int startingTime = 0;
-long unsigned int delayDuration = 0;
+SoftTimer stepTimer; // paces the state machine, see delay() and delayEnd()
 int timeIndex = 0;
 bool startTimer = false;
-int missCounter = 0;
-
-#define noteSize 36
-
-// NOTE ARRAYS
-// stores a pitch, ledValue, and LCD xValue for each term in arrays; denotations in parentheses are for rests
-// pitch -> Hz
-double pitch[noteSize] = {0,0,0,0,
-                    784,784,784,784,
-                    000,784,784,1175,
-                    1047,1047,1047,0,
-                    932,932,880,880,
-                    784,784,784,784,
-                    000,784,784,1175,
-                    1318,1318,1318,0,
-                    1047,0,880,0};
-// ledValue -> (0x00) 0x08 0x04 0x02 0x01
-char ledValue[noteSize] = {0x00,0x00,0x00,0x00,
-                     BIT3,BIT3,BIT3,BIT3,
-                     0x00,BIT3,BIT3,BIT0,
-                     BIT1,BIT1,BIT1,0x00,
-                     BIT1,BIT1,BIT2,BIT2,
-                     BIT3,BIT3,BIT3,BIT3,
-                     0x00,BIT3,BIT3,BIT1,
-                     BIT0,BIT0,BIT0,BIT0,
-                     BIT1,0x00,BIT2,0x00};
-// xValue -> (-10) 20 40 60 80
-int xValue[noteSize] = {-10,-10,-10,-10,
-                  20,20,20,20,
-                  -10,20,20,80,
-                  60,60,60,-10,
-                  60,60,40,40,
-                  20,20,20,20,
-                  -10,20,20,60,
-                  80,80,80,-10,
-                  60,-10,40,-10};
-// (0x00) 0x01 0x02 0x04 0x08
-char buttonValue[noteSize] = {0x00,0x00,0x00,0x00,
-                        BIT0,BIT0,BIT0,BIT0,
-                        0x00,BIT0,BIT0,BIT3,
-                        BIT2,BIT2,BIT2,0x00,
-                        BIT2,BIT2,BIT1,BIT1,
-                        BIT0,BIT0,BIT0,BIT0,
-                        0x00,BIT0,BIT0,BIT2,
-                        BIT3,BIT3,BIT3,0x00,
-                        BIT2,0x00,BIT1,0x00};
+int nextNoteToJudge = 0;     // first song event not yet given to the judge
+unsigned long nextNoteTick = 0; // song tick that event starts at
+unsigned long songTicks = 0;    // length of the song in song ticks
+int heldNote = -1;           // note that was hit and is still sounding, or -1
+bool judgedThisStep = false; // a press was judged since the previous step
+
+// TIMING
+// delay() lengths are in ms; while playing, each step is one song tick
+
+// CPU DUTY CYCLE
+// Uncomment to show how much of the time the CPU was awake on the win and lose
+// screens. Defining EVENT_BUSY_WAIT in events.h gives the figure for a main
+// loop which never sleeps, to compare against.
+//#define showDutyCycle
+
+// SOUND OUTPUT
+// Comment out to play hit notes as square waves on the buzzer instead of wavetable tones on the DAC,
+// which also drops the miss sound
+#define useDacAudio
+// hit notes win over the miss sound when the DAC runs out of voices
+#define hitPriority 2
+#define missPriority 1
+#define hitAmplitude (AUDIO_AMPLITUDE_FULL / 2)
+#define missAmplitude (AUDIO_AMPLITUDE_FULL / 4)
+#define missNote 43 // G2
+#define missSoundMs 150
+uint8_t hitSound = 0;  // DAC sound of the note that was hit, see audioPlay()
+uint8_t missSound = 0; // DAC sound of the latest miss
+SoftTimer missTimer;   // ends the miss sound
+// buzzer notes: a quick attack, a decay to 2/3 of full volume while held and a short fade once let go
+const Envelope hitEnvelope = { ENVELOPE_RATE(12), ENVELOPE_RATE(250), 20, ENVELOPE_RATE(120) };
+
+// EVENT IDS
+// data of the EVENT_TIMER events posted by the software timers
+#define stepTimerId 0
+
+// NOTE HIGHWAY SCENE
+// The play screen is a retained scene: the hit line, one "0" sprite per
+// highway slot and the "Miss!" text. Each step only the sprites that moved
+// are erased and redrawn, so the panel is never cleared while playing.
+#define highwaySlots 5
+#define hitLineY 60
+#define spriteHalfWidth 3
+int spriteX[highwaySlots]; // x position each slot's sprite was last drawn at
+const char *judgementShown = ""; // judgement text under the highway
+bool sceneDrawn = false;
+
+// SONG
+// each event is a note on one lane or a rest, with its MIDI note number and length in song ticks (eighth notes)
+// G5 = 79, A5 = 81, A#5 = 82, C6 = 84, D6 = 86, E6 = 88
+const SongEvent songEvents[] = {
+    SONG_REST(4),
+    SONG_EVENT(79, BIT0, 4),
+    SONG_REST(1),
+    SONG_EVENT(79, BIT0, 2),
+    SONG_EVENT(86, BIT3, 1),
+    SONG_EVENT(84, BIT2, 3),
+    SONG_REST(1),
+    SONG_EVENT(82, BIT2, 2),
+    SONG_EVENT(81, BIT1, 2),
+    SONG_EVENT(79, BIT0, 4),
+    SONG_REST(1),
+    SONG_EVENT(79, BIT0, 2),
+    SONG_EVENT(86, BIT2, 1),
+    SONG_EVENT(88, BIT3, 3),
+    SONG_REST(1),
+    SONG_EVENT(84, BIT2, 1),
+    SONG_REST(1),
+    SONG_EVENT(81, BIT1, 1),
+    SONG_REST(1)
+};
+// tempo map: 120 beats per minute throughout, so a song tick is 250 ms
+const TempoChange songTempo[] = {
+    {0, 120}
+};
+const Song song = {songEvents, sizeof(songEvents) / sizeof(songEvents[0]),
+                   songTempo, sizeof(songTempo) / sizeof(songTempo[0])};
+
+// LANE TABLES
+// lane n is played with the button of bit n; the LEDs above the buttons are numbered the other way round
+// LEDs lit for each set of lanes
+const char laneLeds[16] = {0x00, BIT3, BIT2, BIT3 | BIT2,
+                           BIT1, BIT3 | BIT1, BIT2 | BIT1, BIT3 | BIT2 | BIT1,
+                           BIT0, BIT3 | BIT0, BIT2 | BIT0, BIT3 | BIT2 | BIT0,
+                           BIT1 | BIT0, BIT3 | BIT1 | BIT0, BIT2 | BIT1 | BIT0, BIT3 | BIT2 | BIT1 | BIT0};
+// highway x position for each set of lanes, that of the lowest lane; rests are offscreen
+const int laneX[16] = {-10, 20, 40, 20, 60, 20, 40, 20, 80, 20, 40, 20, 60, 20, 40, 20};
 
 // MAIN
 void main(void) {
     WDTCTL = WDTPW | WDTHOLD;    // Stop watchdog timer. Always need to stop this!!
                                  // You can then configure it properly, if desired
 
-    // timer A2 management
-    TA2CTL = TASSEL_1 + ID_0 + MC_1; // 32786 Hz is set
-    TA2CCR0 = 31; // sets interrupt to occur every (TA2CCR0 + 1)/32786 seconds
-    TA2CCTL0 = CCIE; // enables TA2CCR0 interrupt
+    // 8 MHz MCLK for the audio sample interrupt, 4 MHz SMCLK for the buzzer
+    configClocks();
+
+    // timer A2 management, free running on ACLK and only interrupting when the CPU has to wake up
+    timeInit();
 
     // enables global interrupts
     _BIS_SR(GIE);
@@ -92,12 +154,39 @@ void main(void) {
     // setup for LEDs, LCD, Keypad, Buttons
     initLeds();
     configDisplay();
+    audioInit();
     configKeypad();
-    configButtons();
+    keypadStart();
+    buttonsInit();
+
+    // the end of each LCD flush posts an event
+#ifdef USE_SPI_TX_QUEUE
+    Sharp96x96_SetFlushCallback(flushDone);
+#endif
 
-    // state machine
+    // posts the first event, for entering the RESET state
+    nextState(RESET);
+
+    // state machine, run once for every event
     while (1) {
-        char key = getKey();
+        Event event;
+        char key = 0;
+
+        // sleeps in a low power mode until there is an event
+        eventWait(&event);
+
+        if (event.type == EVENT_KEY) {
+            key = event.data;
+        }
+        else if (event.type == EVENT_BUTTON) {
+            readButtonEdges();
+        }
+#ifdef USE_SPI_TX_QUEUE
+        else if (event.type == EVENT_FLUSH_DONE) {
+            // sends what was drawn while the last flush was running
+            Sharp96x96_RunPendingFlush();
+        }
+#endif
         if (key == '#') {
             nextState(RESET);
         }
@@ -124,9 +213,17 @@ void main(void) {
 // HARDWARE DELAY
 bool delay(long unsigned int millis) {
     //Sets a new delay if one isn't currently running
-    if (delayDuration == 0) {
-        startingTime = currentTime;
-        delayDuration = millis;
+    if (!timerIsActive(&stepTimer)) {
+        timerSet(&stepTimer, timeMsToTicks(millis), 0, stepTimerDone);
+    }
+    return false;
+}
+
+// HARDWARE DELAY TO A TIME
+bool delayUntil(long unsigned int time) {
+    //Sets a new delay ending at the given time, so a series of delays never drifts
+    if (!timerIsActive(&stepTimer)) {
+        timerSetAt(&stepTimer, time, 0, stepTimerDone);
     }
     return false;
 }
@@ -134,7 +231,7 @@ bool delay(long unsigned int millis) {
 // END HARDWARE DELAY
 bool delayEnd() {
     //Returns true if the timer duraiton has ended
-    if (startingTime + delayDuration <= currentTime) {
+    if (!timerIsActive(&stepTimer)) {
         resetTimer();
         timeIndex++;
         return true;
@@ -144,31 +241,94 @@ bool delayEnd() {
 
 //RESET TIMER
 void resetTimer() {
-    //Resets all the timer variables
-    startingTime = 0;
-    delayDuration = 0;
-    currentTime = 0;
-}
-
-// TIMER INTERRUPT
-#pragma vector = TIMER2_A0_VECTOR
-__interrupt void Timer_A2_ISR(void) {
-    //Increments the time count
-    currentTime++;
+    //Stops the running delay, if any
+    timerCancel(&stepTimer);
 }
 
 // RESTART HARDWARE TIMER
 void timerStart() {
     resetTimer();
-    delayDuration = 1;
-    currentTime = 2;
+}
+
+// STEP TIMER CALLBACK
+// Lets the state machine run once the delay has ended
+void stepTimerDone(SoftTimer *timer) {
+    eventPost(EVENT_TIMER, stepTimerId);
+}
+
+// BUTTON EDGE HANDLER
+// Judges each press by the time it happened at; a hit plays the note on the buzzer until it ends or is let go
+void readButtonEdges(void) {
+    ButtonEdge edge;
+    int note;
+    uint8_t judgement;
+    bool judged = false;
+
+    while (buttonGetEdge(&edge)) {
+        // letting go of the button of the sounding note stops it
+        if (!edge.pressed) {
+            if (heldNote >= 0 && (songEventLanes(&songEvents[heldNote]) & edge.button)) {
+                stopSound();
+                heldNote = -1;
+            }
+            continue;
+        }
+        judgement = judgePress(laneOf(edge.button), edge.time, &note);
+        if (judgement != JUDGE_NONE) {
+            showJudgement(judgeName(judgement));
+            heldNote = note;
+            startSound(songEventNote(&songEvents[note]));
+            judged = true;
+        }
+    }
+
+    if (judged) {
+        judgedThisStep = true;
+        Graphics_flushBuffer(&g_sContext);
+    }
+}
+
+// FLUSH COMPLETION CALLBACK
+// Called from the LCD interrupt once a flush has been sent
+void flushDone(void) {
+    eventPost(EVENT_FLUSH_DONE, 0);
 }
 
 //Sets the current state to the input state and resets timer variables
 void nextState(int state) {
+    // silences the song when leaving PLAY
+    if (currentState == PLAY && state != PLAY) {
+        seqStop();
+        stopSound();
+#ifdef useDacAudio
+        audioStop();
+#endif
+        setLeds(0x00);
+    }
+
     currentState = state;
     timeIndex = 0;
     startTimer = false;
+    sceneDrawn = false;
+
+    // the buttons are only sampled while playing
+    if (state == PLAY) {
+#ifdef useDacAudio
+        audioStart();
+#endif
+        buttonsStart();
+        judgeReset();
+        nextNoteToJudge = 0;
+        nextNoteTick = 0;
+        heldNote = -1;
+        judgedThisStep = false;
+    }
+    else {
+        buttonsStop();
+    }
+
+    // the new state's handler runs on this event even if nothing else happens
+    eventPost(EVENT_STATE, state);
 }
 
 // WELCOME STATE HANDLER
@@ -180,31 +340,28 @@ void welcome(char key) {
         timerStart();
     }
 
-    //Resets miss counter to 0
-    missCounter = 0;
-
     if (startTimer) {
         //Plays the 3-2-1 count down
         if (delayEnd()) {
             Graphics_clearDisplay(&g_sContext); // Clear the display
 
             if (timeIndex == 1) {
-                Graphics_drawStringCentered(&g_sContext, "3", AUTO_STRING_LENGTH, 48, 15, TRANSPARENT_TEXT);
+                Sharp96x96_DrawStringCentered(&g_sContext, "3", AUTO_STRING_LENGTH, 48, 15, TRANSPARENT_TEXT);
                 configLEDs(BIT0);
                 delay(1000);
             }
             else if (timeIndex == 2) {
-                Graphics_drawStringCentered(&g_sContext, "2", AUTO_STRING_LENGTH, 48, 15, TRANSPARENT_TEXT);
+                Sharp96x96_DrawStringCentered(&g_sContext, "2", AUTO_STRING_LENGTH, 48, 15, TRANSPARENT_TEXT);
                 configLEDs(BIT1);
                 delay(1000);
             }
             else if (timeIndex == 3) {
-                Graphics_drawStringCentered(&g_sContext, "1", AUTO_STRING_LENGTH, 48, 15, TRANSPARENT_TEXT);
+                Sharp96x96_DrawStringCentered(&g_sContext, "1", AUTO_STRING_LENGTH, 48, 15, TRANSPARENT_TEXT);
                 configLEDs(BIT0);
                 delay(1000);
             }
             else if (timeIndex == 4) {
-                Graphics_drawStringCentered(&g_sContext, "GO", AUTO_STRING_LENGTH, 48, 15, TRANSPARENT_TEXT);
+                Sharp96x96_DrawStringCentered(&g_sContext, "GO", AUTO_STRING_LENGTH, 48, 15, TRANSPARENT_TEXT);
                 configLEDs(BIT0 | BIT1);
                 delay(1000);
             }
@@ -212,6 +369,10 @@ void welcome(char key) {
                 configLEDs(0x00);
                 nextState(PLAY);
                 timerStart();
+#ifdef showDutyCycle
+                // starts measuring the duty cycle of the song
+                timeAwakePercent();
+#endif
             }
             Graphics_flushBuffer(&g_sContext);
         }
@@ -224,10 +385,10 @@ void reset(char key) {
     Graphics_clearDisplay(&g_sContext); // Clear the display
 
     // Write some text to the display
-    Graphics_drawStringCentered(&g_sContext, "MSP40 Hero", AUTO_STRING_LENGTH, 48, 15, TRANSPARENT_TEXT);
-    Graphics_drawStringCentered(&g_sContext, "Welcome", AUTO_STRING_LENGTH, 48, 25, TRANSPARENT_TEXT);
-    Graphics_drawStringCentered(&g_sContext, "Press *", AUTO_STRING_LENGTH, 48, 45, TRANSPARENT_TEXT);
-    Graphics_drawStringCentered(&g_sContext, "To Begin", AUTO_STRING_LENGTH, 48, 55, TRANSPARENT_TEXT);
+    Sharp96x96_DrawStringCentered(&g_sContext, "MSP40 Hero", AUTO_STRING_LENGTH, 48, 15, TRANSPARENT_TEXT);
+    Sharp96x96_DrawStringCentered(&g_sContext, "Welcome", AUTO_STRING_LENGTH, 48, 25, TRANSPARENT_TEXT);
+    Sharp96x96_DrawStringCentered(&g_sContext, "Press *", AUTO_STRING_LENGTH, 48, 45, TRANSPARENT_TEXT);
+    Sharp96x96_DrawStringCentered(&g_sContext, "To Begin", AUTO_STRING_LENGTH, 48, 55, TRANSPARENT_TEXT);
 
     //Pushes new screen update
     Graphics_flushBuffer(&g_sContext);
@@ -237,7 +398,7 @@ void reset(char key) {
     timeIndex = 0;
     startTimer = false;
     configLEDs(0x00);
-    BuzzerOff();
+    stopSound();
     setLeds(0x00);
 
     currentState = WELCOME;
@@ -251,47 +412,71 @@ void play(char key) {
             timerStart();
     }
 
-    //Runs when the timer has finished its duration
+    //Runs once per song tick
     if (delayEnd()) {
 
-        // displays five sequential 'notes' at a time as zeroes on screen (rests are zeroes stores offscreen for organization)
-        // displays five notes in advance so player can see notes coming
-        Graphics_clearDisplay(&g_sContext); //clear screen
-        Graphics_drawStringCentered(&g_sContext, "0", AUTO_STRING_LENGTH, xValue[timeIndex+3], 20, TRANSPARENT_TEXT);
-        Graphics_drawStringCentered(&g_sContext, "0", AUTO_STRING_LENGTH, xValue[timeIndex+2], 30, TRANSPARENT_TEXT);
-        Graphics_drawStringCentered(&g_sContext, "0", AUTO_STRING_LENGTH, xValue[timeIndex+1], 40, TRANSPARENT_TEXT);
-        Graphics_drawStringCentered(&g_sContext, "0", AUTO_STRING_LENGTH, xValue[timeIndex], 50, TRANSPARENT_TEXT);
-        Graphics_drawStringCentered(&g_sContext, "0", AUTO_STRING_LENGTH, xValue[timeIndex-1], 60, TRANSPARENT_TEXT);
-        Graphics_drawLine(&g_sContext,0,60,96,60);
-
-        // sets LED value of current note in array
-        setLeds(ledValue[timeIndex-1]);
-
-        if(buttonValue[timeIndex-1] == buttonStates()) { // if button pressed corresponds to i'th button value, play i'th pitch value on buzzer
-            BuzzerOn(pitch[timeIndex-1]);
+        unsigned long songTick = timeIndex - 1; // song tick at the hit line
+        int slot;
+
+        // draws the static parts of the scene and starts the song once after entering PLAY,
+        // with the first five song ticks on the highway
+        if (!sceneDrawn) {
+            drawScene();
+            seqStart(&song, timeNow(), noteOn, noteOff);
+            songTicks = seqLength();
+
+            for (slot = highwaySlots - 1; slot >= 0; slot--) {
+                moveSprite(slot, xAtTick(songTick + 4 - slot));
+            }
         }
+        // moves every note one slot down the highway, and shows the song tick that came into view at the top
         else {
-            BuzzerOff();
-            if(xValue[timeIndex-1] > 10) { // if i'th note is not a rest and was not pressed, add to missCounter and display "Miss!" at bottom
-                missCounter++;
-                Graphics_drawStringCentered(&g_sContext, "Miss!", AUTO_STRING_LENGTH, 48, 80, TRANSPARENT_TEXT);
+            for (slot = highwaySlots - 1; slot > 0; slot--) {
+                moveSprite(slot, spriteX[slot - 1]);
             }
+            moveSprite(0, xAtTick(songTick + 4));
         }
 
+        // gives the judge the notes that came into view, with the time they reach the hit line
+        for (; nextNoteToJudge < song.eventCount && nextNoteTick <= songTick + 4; nextNoteToJudge++) {
+            const SongEvent *event = &songEvents[nextNoteToJudge];
+            char lanes = songEventLanes(event);
+            int lane;
+
+            for (lane = 0; lanes >> lane; lane++) {
+                if (lanes & (1 << lane)) {
+                    judgeAddNote(lane, seqTickTime(nextNoteTick), nextNoteToJudge);
+                }
+            }
+            nextNoteTick += songEventLength(event);
+        }
+
+        // judges the presses not handled yet, then the notes that were never hit
+        readButtonEdges();
+        if (judgeExpire(timeNow())) {
+            showJudgement(judgeName(JUDGE_MISS));
+            playMissSound();
+        }
+        else if (!judgedThisStep) {
+            showJudgement("");
+        }
+        judgedThisStep = false;
+
         Graphics_flushBuffer(&g_sContext);
 
-        // lose condition: if missCounter reaches 5, send to LOSE state
-        if(missCounter > 50) {
+        // lose condition: if more than 50 notes are missed, send to LOSE state
+        if(judgeStats()->count[JUDGE_MISS] > 50) {
             nextState(LOSE);
             resetTimer();
         }
         //Runs if win state is reached
-        else if(timeIndex > noteSize) {
+        else if(songTick >= songTicks) {
             nextState(WIN);
             resetTimer();
         }
-
-        delay(250);
+        else {
+            delayUntil(seqTickTime(songTick + 1));
+        }
     }
 }
 
@@ -308,8 +493,9 @@ void win(void) {
             Graphics_clearDisplay(&g_sContext); // Clear the display
 
             // Write win text to the display
-            Graphics_drawStringCentered(&g_sContext, "You Win!", AUTO_STRING_LENGTH, 48, 15, TRANSPARENT_TEXT);
-            Graphics_drawStringCentered(&g_sContext, ":D", AUTO_STRING_LENGTH, 48, 25, TRANSPARENT_TEXT);
+            Sharp96x96_DrawStringCentered(&g_sContext, "You Win!", AUTO_STRING_LENGTH, 48, 15, TRANSPARENT_TEXT);
+            Sharp96x96_DrawStringCentered(&g_sContext, ":D", AUTO_STRING_LENGTH, 48, 25, TRANSPARENT_TEXT);
+            showResults();
 
             //Pushes new screen update
             Graphics_flushBuffer(&g_sContext);
@@ -336,8 +522,9 @@ void lose(void) {
             Graphics_clearDisplay(&g_sContext); // Clear the display
 
             // Write lose text to the display
-            Graphics_drawStringCentered(&g_sContext, "You Lose...", AUTO_STRING_LENGTH, 48, 15, TRANSPARENT_TEXT);
-            Graphics_drawStringCentered(&g_sContext, ":(", AUTO_STRING_LENGTH, 48, 25, TRANSPARENT_TEXT);
+            Sharp96x96_DrawStringCentered(&g_sContext, "You Lose...", AUTO_STRING_LENGTH, 48, 15, TRANSPARENT_TEXT);
+            Sharp96x96_DrawStringCentered(&g_sContext, ":(", AUTO_STRING_LENGTH, 48, 25, TRANSPARENT_TEXT);
+            showResults();
 
             //Pushes new screen update
             Graphics_flushBuffer(&g_sContext);
@@ -351,47 +538,6 @@ void lose(void) {
     }
 }
 
-// BUTTON CONFIGURATION HELPER
-void configButtons() {
-    //Sets P2.2, P3.6, P7.0, and P7.4 to IO
-    P2SEL &= ~BIT2;
-    P3SEL &= ~BIT6;
-    P7SEL &= ~(BIT0 | BIT4);
-
-    //Sets P2.2, P3.6, P7.0, and P7.4 to input
-    P2DIR &= ~BIT2;
-    P3DIR &= ~BIT6;
-    P7DIR &= ~(BIT0 | BIT4);
-
-    //Sets pins to use pull up/down
-    P2REN |= BIT2;
-    P3REN |= BIT6;
-    P7REN |= (BIT0 | BIT4);
-
-    //Sets pins to pull up
-    P2OUT |= BIT2;
-    P3OUT |= BIT6;
-    P7OUT |= (BIT0 | BIT4);
-}
-
-// BUTTON PRESS CHECKING HANDLER
-char buttonStates() {
-    char returnState = 0x00;
-    if ((P2IN & BIT2) == 0) {
-        returnState |= BIT2;
-    }
-    if ((P3IN & BIT6) == 0) {
-        returnState |= BIT1;
-    }
-    if ((P7IN & BIT0) == 0) {
-        returnState |= BIT0;
-    }
-    if ((P7IN & BIT4) == 0) {
-        returnState |= BIT3;
-    }
-    return returnState;
-}
-
 // LED CONFIGURATION HELPER
 void configLEDs(char inbits) {
     //Sets pins to IO
@@ -415,4 +561,168 @@ void configLEDs(char inbits) {
     }
 }
 
+// NOTE POSITION HELPER
+// Returns the highway x position of the note playing at a song tick, rests and ticks after the song are offscreen
+int xAtTick(unsigned long tick) {
+    unsigned long startTick;
+    int index = seqEventAt(tick, &startTick);
+
+    if (index < 0) {
+        return -10;
+    }
+    return laneX[songEventLanes(&songEvents[index])];
+}
+
+// NOTE ON HANDLER
+// Called by the sequencer when a song event starts: lights its LEDs
+void noteOn(int index) {
+    setLeds(laneLeds[songEventLanes(&songEvents[index])]);
+}
+
+// NOTE OFF HANDLER
+// Called by the sequencer when a song event ends: turns off its LEDs and stops the sound if the note was hit
+void noteOff(int index) {
+    setLeds(0x00);
+    if (heldNote == index) {
+        stopSound();
+        heldNote = -1;
+    }
+}
+
+// SCENE SETUP
+// Clears the panel and draws the parts of the play screen that never change
+void drawScene() {
+    int slot;
+
+    Graphics_clearDisplay(&g_sContext);
+    Graphics_drawLine(&g_sContext, 0, hitLineY, 96, hitLineY);
+
+    for (slot = 0; slot < highwaySlots; slot++) {
+        spriteX[slot] = -10;
+    }
+    judgementShown = "";
+    sceneDrawn = true;
+}
+
+// SPRITE UPDATE
+// Moves the sprite of a highway slot to x, touching the display only if it moved
+void moveSprite(int slot, int x) {
+    int y = 20 + 10 * slot;
+
+    if (spriteX[slot] == x) {
+        return;
+    }
+
+    eraseStringCentered("0", spriteX[slot], y);
+
+    // puts back the part of the hit line under the erased sprite
+    if (y == hitLineY) {
+        Graphics_drawLineH(&g_sContext, spriteX[slot] - spriteHalfWidth, spriteX[slot] + spriteHalfWidth - 1, hitLineY);
+    }
+
+    Sharp96x96_DrawStringCentered(&g_sContext, "0", AUTO_STRING_LENGTH, x, y, TRANSPARENT_TEXT);
+    spriteX[slot] = x;
+}
+
+// JUDGEMENT TEXT UPDATE
+// Shows the text of the latest judgement, or hides it for "", touching the display only if it changes
+void showJudgement(const char *text) {
+    if (text == judgementShown) {
+        return;
+    }
 
+    eraseStringCentered(judgementShown, 48, 80);
+    Sharp96x96_DrawStringCentered(&g_sContext, text, AUTO_STRING_LENGTH, 48, 80, TRANSPARENT_TEXT);
+    judgementShown = text;
+}
+
+// LANE HELPER
+// Returns the judge lane of a button bit
+int laneOf(char button) {
+    int lane = 0;
+
+    while (button > 1) {
+        button >>= 1;
+        lane++;
+    }
+    return lane;
+}
+
+// TEXT ERASE HELPER
+// Erases centered text by drawing it again in the background color
+void eraseStringCentered(const char *string, int x, int y) {
+    Graphics_setForegroundColor(&g_sContext, ClrWhite);
+    Sharp96x96_DrawStringCentered(&g_sContext, string, AUTO_STRING_LENGTH, x, y, TRANSPARENT_TEXT);
+    Graphics_setForegroundColor(&g_sContext, ClrBlack);
+}
+
+// RESULTS TEXT
+// Shows the accuracy and longest combo of the song, and the share of time the CPU was awake and spent on audio samples if showDutyCycle is defined
+void showResults(void) {
+    char accuracy[] = "Acc   0%";
+    char combo[] = "Combo     0";
+
+    drawNumber(accuracy, 6, judgeAccuracy(), 45);
+    drawNumber(combo, 10, judgeStats()->maxCombo, 55);
+#ifdef showDutyCycle
+    {
+        char cpu[] = "CPU   0%";
+        drawNumber(cpu, 6, timeAwakePercent(), 70);
+#ifdef useDacAudio
+        {
+            char audio[] = "Audio   0%";
+            drawNumber(audio, 8, audioLoadPercent(), 80);
+        }
+#endif
+    }
+#endif
+}
+
+// NUMBER TEXT HELPER
+// Writes value into text with its last digit at lastDigit, then draws the text centered at y
+void drawNumber(char *text, int lastDigit, unsigned int value, int y) {
+    do {
+        text[lastDigit--] = '0' + value % 10;
+        value /= 10;
+    } while (value != 0);
+
+    Sharp96x96_DrawStringCentered(&g_sContext, text, AUTO_STRING_LENGTH, 48, y, TRANSPARENT_TEXT);
+}
+
+// SOUND HELPERS
+// Plays a MIDI note on the DAC or the buzzer in place of the previous one, see useDacAudio
+void startSound(unsigned char note) {
+#ifdef useDacAudio
+    audioRelease(hitSound);
+    hitSound = audioPlay(note, waveOrgan, hitAmplitude, hitPriority);
+#else
+    envelopeNoteOn(note, &hitEnvelope);
+#endif
+}
+
+// Stops the note started by startSound()
+void stopSound(void) {
+#ifdef useDacAudio
+    audioRelease(hitSound);
+    hitSound = 0;
+#else
+    envelopeNoteOff();
+#endif
+}
+
+// Plays a short low tone over any note that is sounding when a note is missed
+void playMissSound(void) {
+#ifdef useDacAudio
+    audioRelease(missSound);
+    missSound = audioPlay(missNote, waveReed, missAmplitude, missPriority);
+    timerSet(&missTimer, TIME_MS_TO_TICKS(missSoundMs), 0, missSoundDone);
+#endif
+}
+
+// MISS SOUND TIMER CALLBACK
+void missSoundDone(SoftTimer *timer) {
+#ifdef useDacAudio
+    audioRelease(missSound);
+    missSound = 0;
+#endif
+}
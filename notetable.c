@@ -0,0 +1,96 @@
+/*
+ * notetable.c
+ *
+ * Timer B0 settings for playing MIDI notes on the buzzer, see notetable.h.
+ * The comment of each note is its tuning error in cents.
+ */
+
+#include "notetable.h"
+
+const NotePeriod notePeriods[NOTE_COUNT] = {
+    {TBSSEL__ACLK  | ID__1, TBIDEX_0,  1001,   501},  // C1  0.03
+    {TBSSEL__ACLK  | ID__1, TBIDEX_0,   945,   473},  // C#1 0.47
+    {TBSSEL__ACLK  | ID__1, TBIDEX_0,   892,   446},  // D1  0.65
+    {TBSSEL__ACLK  | ID__1, TBIDEX_0,   842,   421},  // D#1 0.90
+    {TBSSEL__ACLK  | ID__1, TBIDEX_0,   794,   397},  // E1  0.60
+    {TBSSEL__ACLK  | ID__1, TBIDEX_0,   750,   375},  // F1  0.83
+    {TBSSEL__SMCLK | ID__1, TBIDEX_1, 45344, 22672},  // F#1 0.02
+    {TBSSEL__ACLK  | ID__1, TBIDEX_0,   668,   334},  // G1  0.67
+    {TBSSEL__ACLK  | ID__1, TBIDEX_0,   630,   315},  // G#1 0.57
+    {TBSSEL__ACLK  | ID__1, TBIDEX_0,   595,   298},  // A1  0.63
+    {TBSSEL__SMCLK | ID__1, TBIDEX_1, 35989, 17995},  // A#1 0.00
+    {TBSSEL__ACLK  | ID__1, TBIDEX_0,   530,   265},  // B1  0.71
+    {TBSSEL__ACLK  | ID__1, TBIDEX_0,   500,   250},  // C2  0.03
+    {TBSSEL__ACLK  | ID__1, TBIDEX_0,   472,   236},  // C#2 0.47
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 57130, 28565},  // D2  0.02
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 53923, 26962},  // D#2 0.00
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 50896, 25448},  // E2  0.02
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 48040, 24020},  // F2  0.01
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 45344, 22672},  // F#2 0.02
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 42799, 21400},  // G2  0.02
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 40396, 20198},  // G#2 0.02
+    {TBSSEL__ACLK  | ID__1, TBIDEX_0,   297,   149},  // A2  0.63
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 35989, 17995},  // A#2 0.00
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 33969, 16985},  // B2  0.00
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 32062, 16031},  // C3  0.02
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 30263, 15132},  // C#3 0.01
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 28564, 14282},  // D3  0.02
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 26961, 13481},  // D#3 0.00
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 25448, 12724},  // E3  0.02
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 24019, 12010},  // F3  0.03
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 22671, 11336},  // F#3 0.02
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 21399, 10700},  // G3  0.02
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 20198, 10099},  // G#3 0.03
+    {TBSSEL__ACLK  | ID__1, TBIDEX_0,   148,    74},  // A3  0.63
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 17994,  8997},  // A#3 0.00
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 16984,  8492},  // B3  0.00
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 16031,  8016},  // C4  0.03
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 15131,  7566},  // C#4 0.01
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 14282,  7141},  // D4  0.05
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 13480,  6740},  // D#4 0.00
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 12723,  6362},  // E4  0.05
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 12009,  6005},  // F4  0.03
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 11335,  5668},  // F#4 0.02
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 10699,  5350},  // G4  0.02
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0, 10098,  5049},  // G#4 0.06
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  9532,  4766},  // A4  0.09
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  8996,  4498},  // A#4 0.09
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  8492,  4246},  // B4  0.10
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  8015,  4008},  // C5  0.03
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  7565,  3783},  // C#5 0.01
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  7140,  3570},  // D5  0.08
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  6740,  3370},  // D#5 0.13
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  6361,  3181},  // E5  0.05
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  6004,  3002},  // F5  0.03
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  5667,  2834},  // F#5 0.02
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  5349,  2675},  // G5  0.02
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  5049,  2525},  // G#5 0.11
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  4765,  2383},  // A5  0.09
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  4498,  2249},  // A#5 0.10
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  4245,  2123},  // B5  0.10
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  4007,  2004},  // C6  0.03
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  3782,  1891},  // C#6 0.01
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  3570,  1785},  // D6  0.17
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  3369,  1685},  // D#6 0.13
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  3180,  1590},  // E6  0.05
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  3002,  1501},  // F6  0.26
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  2833,  1417},  // F#6 0.02
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  2674,  1337},  // G6  0.02
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  2524,  1262},  // G#6 0.11
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  2382,  1191},  // A6  0.09
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  2248,  1124},  // A#6 0.29
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  2122,  1061},  // B6  0.10
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  2003,  1002},  // C7  0.03
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  1890,   945},  // C#7 0.45
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  1784,   892},  // D7  0.32
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  1684,   842},  // D#7 0.13
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  1590,   795},  // E7  0.49
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  1500,   750},  // F7  0.32
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  1416,   708},  // F#7 0.02
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  1336,   668},  // G7  0.63
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  1261,   631},  // G#7 0.57
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  1191,   596},  // A7  0.63
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  1124,   562},  // A#7 0.48
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  1061,   531},  // B7  0.71
+    {TBSSEL__SMCLK | ID__1, TBIDEX_0,  1001,   501}   // C8  0.03
+};
@@ -0,0 +1,39 @@
+/*
+ * notetable.h
+ *
+ * Timer B0 settings for playing MIDI notes on the buzzer.
+ *
+ * For each note the table holds the clock, the dividers and the TB0CCR0
+ * value giving its period in up mode, plus the TB0CCR5 value for a 50% duty
+ * cycle, all worked out ahead of time so playing a note is only a few
+ * register writes. The clock and dividers are chosen per note to keep the
+ * period within 1 cent of equal temperament (440 Hz A4):
+ *  - ACLK (32768 Hz) wherever it is that accurate, as it keeps running in
+ *    LPM3,
+ *  - otherwise SMCLK (4194304 Hz, see configClocks() in peripherals.c) with
+ *    the smallest division that fits the period in 16 bits.
+ * The worst note is 0.9 cents out; with ACLK alone the top notes were out by
+ * over 70 cents.
+ */
+
+#ifndef NOTETABLE_H_
+#define NOTETABLE_H_
+
+#include <msp430.h>
+#include <stdint.h>
+
+// Range of MIDI notes in the table, C1 to C8
+#define NOTE_LOWEST     24
+#define NOTE_HIGHEST    108
+#define NOTE_COUNT      (NOTE_HIGHEST - NOTE_LOWEST + 1)
+
+typedef struct NotePeriod {
+    uint16_t control;   // TB0CTL clock source and ID divider
+    uint16_t extend;    // TB0EX0 TBIDEX divider
+    uint16_t period;    // TB0CCR0
+    uint16_t duty;      // TB0CCR5
+} NotePeriod;
+
+extern const NotePeriod notePeriods[NOTE_COUNT];
+
+#endif /* NOTETABLE_H_ */
@@ -15,12 +15,71 @@
  */
 
 #include "peripherals.h"
+#include "notetable.h"
+#include "timebase.h"
 
 
 // Globals
 tContext g_sContext;    // user defined type used by graphics library
 
 
+/*
+ * Raises the core voltage one level at a time up to level, following the
+ * sequence in the MSP430F5xx user's guide: the high and low side supervisors
+ * are moved up first, then VCore once the supply is known to be high enough
+ */
+static void setVCoreUp(unsigned int level)
+{
+    unsigned int step;
+
+    for (step = (PMMCTL0 & PMMCOREV_3) + 1; step <= level; step++) {
+        PMMCTL0_H = PMMPW_H;                    // Unlock the PMM registers
+
+        SVSMHCTL = SVSHE + SVSHRVL0 * step + SVMHE + SVSMHRRL0 * step;
+        SVSMLCTL = SVSLE + SVMLE + SVSMLRRL0 * step;
+        while ((PMMIFG & SVSMLDLYIFG) == 0);    // Wait for the SVM to settle
+        PMMIFG &= ~(SVMLVLRIFG + SVMLIFG);
+
+        PMMCTL0_L = PMMCOREV0 * step;
+        if (PMMIFG & SVMLIFG) {
+            while ((PMMIFG & SVMLVLRIFG) == 0); // Wait for VCore to get there
+        }
+        SVSMLCTL = SVSLE + SVSLRVL0 * step + SVMLE + SVSMLRRL0 * step;
+
+        PMMCTL0_H = 0x00;                       // Lock the PMM registers
+    }
+}
+
+void configClocks(void)
+{
+    // Runs MCLK at 8388608 Hz and SMCLK at 4194304 Hz (128 x 32768), for
+    // finely tuned buzzer notes and enough CPU time for the audio sample
+    // interrupt. The DCO is locked by the FLL to the 32768 Hz crystal (or
+    // REFO if the crystal fails) and runs at twice the DCOCLKDIV frequency.
+    // Above 8 MHz the core needs VCore level 1.
+    setVCoreUp(1);
+
+    // Enable use of external clock crystals
+    P5SEL |= (BIT5|BIT4|BIT3|BIT2);
+
+    __bis_SR_register(SCG0);            // Disable the FLL while setting it up
+    UCSCTL0 = 0x0000;                   // Lowest DCO tap, the FLL moves it
+    UCSCTL1 = DCORSEL_4;                // DCO range covering 8.4 MHz
+    UCSCTL2 = FLLD_1 | 127;             // DCOCLKDIV = (127 + 1) x 32768 Hz
+    UCSCTL4 = SELA__XT1CLK | SELS__DCOCLKDIV | SELM__DCOCLK;
+    UCSCTL5 = DIVM__1 | DIVS__1;        // MCLK = DCOCLK, SMCLK = DCOCLKDIV
+    __bic_SR_register(SCG0);            // Enable the FLL
+
+    // Worst case DCO settling time is 32 x 32 x fMCLK / fFLLREF MCLK cycles
+    __delay_cycles(262144);
+
+    // Wait for the oscillator fault flags to stay clear
+    do {
+        UCSCTL7 &= ~(XT2OFFG | XT1LFOFFG | DCOFFG);
+        SFRIFG1 &= ~OFIFG;
+    } while (SFRIFG1 & OFIFG);
+}
+
 void initLeds(void)
 {
     // Configure LEDs as outputs, initialize to logic low (off)
@@ -68,38 +127,205 @@ void setLeds(unsigned char state)
 
 
 /*
- * Enable a PWM-controlled buzzer on P3.5
+ * Buzzer state
+ * Timer B0 keeps running between notes, so a change of note is only a few
+ * register writes at a period boundary instead of a restart mid-cycle:
+ *  - TB0CCR0 and TB0CCR5 are set with CLLD_1, so new values only reach the
+ *    compare latches when the timer wraps to 0 and the note changes legato,
+ *    with no shortened or doubled pulse,
+ *  - a note on another clock or divider, and stopping, wait for the TB0CCR5
+ *    interrupt, right after a pulse has ended and the output is low.
+ * Playing the note already sounding does nothing at all.
+ */
+#define BUZZER_PENDING_NONE     0
+#define BUZZER_PENDING_STOP     1   // stop after the current pulse
+#define BUZZER_PENDING_SWITCH   2   // start buzzerNext after the current pulse
+
+static NotePeriod buzzerSetting;            // settings Timer B0 plays
+static NotePeriod buzzerNext;               // settings waiting for a switch
+static unsigned char buzzerSounding = 0;
+static volatile unsigned char buzzerPending = BUZZER_PENDING_NONE;
+
+/*
+ * Starts Timer B0 from stopped with a setting. The count starts at the end
+ * of the pulse, so the output, which is low, goes high at the next wrap.
+ */
+static void buzzerStart(const NotePeriod *setting)
+{
+    TB0CTL    = MC__STOP;
+    TB0EX0    = setting->extend;
+    TB0CTL    = (setting->control|TBCLR);   // Clears the count and the dividers
+
+    // Loaded straight away with CLLD_0, then at each wrap to 0
+    TB0CCTL0  = 0;
+    TB0CCR0   = setting->period;
+    TB0CCTL0  = CLLD_1;
+    TB0CCTL5  = OUTMOD_7;                   // Set/reset mode for PWM
+    TB0CCR5   = setting->duty;
+    TB0CCTL5  = (OUTMOD_7|CLLD_1);
+
+    TB0R      = setting->duty;
+    TB0CTL    = (setting->control|MC__UP);  // Up mode, no interrupts
+
+    buzzerSetting = *setting;
+    buzzerSounding = 1;
+}
+
+/*
+ * Plays a Timer B0 setting in place of the one sounding
+ */
+static void buzzerPlay(const NotePeriod *setting)
+{
+    unsigned short state = __get_interrupt_state();
+
+    __disable_interrupt();
+
+    if (!buzzerSounding) {
+        // Initialize PWM output on P3.5, which corresponds to TB0.5
+        P3SEL |= BIT5;
+        P3DIR |= BIT5;
+        timeSmclkUser(BuzzerNeedsSmclk);
+        buzzerStart(setting);
+    }
+    else if (setting->control == buzzerSetting.control &&
+             setting->extend == buzzerSetting.extend) {
+        // Same clock, so the new period is latched at the next wrap. A
+        // pending stop or switch is called off, as this note replaces it.
+        buzzerPending = BUZZER_PENDING_NONE;
+        TB0CCTL5 &= ~CCIE;
+        if (setting->period != buzzerSetting.period || setting->duty != buzzerSetting.duty) {
+            TB0CCR0 = setting->period;
+            TB0CCR5 = setting->duty;
+            buzzerSetting = *setting;
+        }
+    }
+    else {
+        // The clock cannot change while counting, wait for the pulse to end
+        buzzerNext = *setting;
+        buzzerPending = BUZZER_PENDING_SWITCH;
+        TB0CCTL5 = (TB0CCTL5 & ~CCIFG) | CCIE;
+    }
+
+    __set_interrupt_state(state);
+}
+
+/*
+ * Enable a PWM-controlled buzzer on P3.5 at a frequency of ticks Hz
  * This function makes use of TimerB0.
  */
 void BuzzerOn(int ticks)
 {
-    // Initialize PWM output on P3.5, which corresponds to TB0.5
-    P3SEL |= BIT5; // Select peripheral output mode for P3.5
-    P3DIR |= BIT5;
+    NotePeriod setting;
+
+    // A frequency of 0 is a rest
+    if (ticks <= 0) {
+        BuzzerOff();
+        return;
+    }
+
+    // Timer B0 uses ACLK, divided by 1
+    // Integer math only, rounded to the nearest ACLK tick; the timer counts CCR0 + 1 ticks per period
+    // BuzzerNote() looks the period up instead
+    setting.control = (TBSSEL__ACLK|ID__1);
+    setting.extend  = TBIDEX_0;
+    setting.period  = (32768UL + ticks / 2) / ticks - 1;   // Set the PWM period in ACLK ticks
+    setting.duty    = setting.period/2;                     // Configure a 50% duty cycle
+    buzzerPlay(&setting);
+}
 
-    TB0CTL  = (TBSSEL__ACLK|ID__1|MC__UP);  // Configure Timer B0 to use ACLK, divide by 1, up mode
-    TB0CTL  &= ~TBIE;                       // Explicitly Disable timer interrupts for safety
+/*
+ * Play a MIDI note number on the buzzer
+ * The Timer B0 clock, dividers, period and duty cycle all come from the
+ * table in notetable.c, which picks them per note to stay within 1 cent.
+ * A note played while another sounds takes over at its next period.
+ */
+void BuzzerNote(unsigned char note)
+{
+    if (note < NOTE_LOWEST || note > NOTE_HIGHEST) {
+        BuzzerOff();
+        return;
+    }
+    buzzerPlay(&notePeriods[note - NOTE_LOWEST]);
+}
 
-    // Now configure the timer period, which controls the PWM period
-    // Doing this with a hard coded values is NOT the best method
-    // We do it here only as an example. You will fix this in Lab 2.
-    TB0CCR0   = 32768.0 / (double)ticks;                    // Set the PWM period in ACLK ticks
-    TB0CCTL0 &= ~CCIE;                  // Disable timer interrupts
+/*
+ * Sets the buzzer duty cycle, as the TB0CCR5 value for the note sounding.
+ * Like a change of note, it takes effect from the next period.
+ */
+void BuzzerSetDuty(unsigned int duty)
+{
+    unsigned short state = __get_interrupt_state();
+
+    __disable_interrupt();
+    if (buzzerPending == BUZZER_PENDING_SWITCH) {
+        buzzerNext.duty = duty;
+    }
+    else if (buzzerSounding) {
+        TB0CCR5 = duty;
+        buzzerSetting.duty = duty;
+    }
+    __set_interrupt_state(state);
+}
 
-    // Configure CC register 5, which is connected to our PWM pin TB0.5
-    TB0CCTL5  = OUTMOD_7;                   // Set/reset mode for PWM
-    TB0CCTL5 &= ~CCIE;                      // Disable capture/compare interrupts
-    TB0CCR5   = TB0CCR0/2;                  // Configure a 50% duty cycle
+/*
+ * Returns true while the buzzer is sounding from SMCLK, which stops in LPM3,
+ * or is about to switch to a note on SMCLK. Registered with the time base the
+ * first time the buzzer sounds.
+ */
+bool BuzzerNeedsSmclk(void)
+{
+    if (buzzerPending == BUZZER_PENDING_SWITCH &&
+        (buzzerNext.control & TBSSEL_3) == TBSSEL__SMCLK) {
+        return true;
+    }
+    return buzzerSounding && ((TB0CTL & TBSSEL_3) == TBSSEL__SMCLK);
 }
 
 /*
- * Disable the buzzer on P7.5
+ * Disable the buzzer on P3.5 once the current pulse has ended
  */
 void BuzzerOff(void)
 {
-    // Disable both capture/compare periods
-    TB0CCTL0 = 0;
-    TB0CCTL5 = 0;
+    unsigned short state = __get_interrupt_state();
+
+    __disable_interrupt();
+    if (buzzerSounding) {
+        buzzerPending = BUZZER_PENDING_STOP;
+        TB0CCTL5 = (TB0CCTL5 & ~CCIFG) | CCIE;
+    }
+    __set_interrupt_state(state);
+}
+
+/*
+ * Timer B0 CCR5 interrupt, at the end of a pulse while a stop or a switch to
+ * another clock is pending
+ */
+#pragma vector=TIMER0_B1_VECTOR
+__interrupt void TIMER0_B1_ISR(void)
+{
+    switch (__even_in_range(TB0IV, 14)) {
+    case TB0IV_TBCCR5:
+        TB0CCTL5 &= ~CCIE;
+        if (buzzerPending == BUZZER_PENDING_STOP) {
+            // Output mode 0 keeps the pin low
+            TB0CTL   = (MC__STOP|TBCLR);
+            TB0CCTL0 = 0;
+            TB0CCTL5 = 0;
+            buzzerSounding = 0;
+        }
+        else if (buzzerPending == BUZZER_PENDING_SWITCH) {
+            buzzerStart(&buzzerNext);
+
+            // SMCLK stops in LPM3, so let the main loop pick LPM0 instead
+            if ((buzzerNext.control & TBSSEL_3) == TBSSEL__SMCLK) {
+                __bic_SR_register_on_exit(LPM3_bits);
+            }
+        }
+        buzzerPending = BUZZER_PENDING_NONE;
+        break;
+    default:
+        break;
+    }
 }
 
 
@@ -233,13 +459,3 @@ void setupSPI_DAC(void)
 }
 */
 
-//------------------------------------------------------------------------------
-// Timer1 A0 Interrupt Service Routine
-//------------------------------------------------------------------------------
-#pragma vector=TIMER1_A0_VECTOR
-__interrupt void TIMER1_A0_ISR (void)
-{
-	// Display is using Timer A1
-	// Not sure where Timer A1 is configured?
-	Sharp96x96_SendToggleVCOMCommand();  // display needs this toggle < 1 per sec
-}
@@ -54,9 +54,16 @@
  * The actual clock frequency is given in number of
  * ticks of the specified clock source.
  *
- * For our configuration, we use SMCLK */
+ * For our configuration, we use SMCLK / 1, 4.19MHz, which the
+ * arbiter in spibus.c sets up for each DAC write */
 #define DAC_SPI_CLK_SRC		(UCSSEL__SMCLK)
-#define DAC_SPI_CLK_TICKS	0
+#define DAC_SPI_CLK_TICKS	1
+
+/*
+ * Clock frequencies set by configClocks()
+ */
+#define MCLK_HZ				8388608UL
+#define SMCLK_HZ			4194304UL
 
 // Globals
 extern tContext g_sContext;	// user defined type used by graphics library
@@ -66,12 +73,16 @@ extern tContext g_sContext;	// user defined type used by graphics library
 //void DACInit(void);
 //void DACSetValue(unsigned int dac_code);
 //void setupSPI_DAC(void);
+void configClocks(void);
 void initLeds(void);
 void setLeds(unsigned char state);
 
 void configDisplay(void);
 void BuzzerOn(int ticks);
+void BuzzerNote(unsigned char note);
+void BuzzerSetDuty(unsigned int duty);
 void BuzzerOff(void);
+bool BuzzerNeedsSmclk(void);
 
 void configKeypad(void);
 unsigned char getKey(void);
@@ -0,0 +1,136 @@
+/*
+ * sequencer.c
+ *
+ * Tempo based song sequencer, see sequencer.h.
+ */
+
+#include "sequencer.h"
+
+// ACLK ticks per minute
+#define ticksPerMinute  (60 * TIME_TICKS_PER_SECOND)
+
+static const Song *seqSong = 0;
+static unsigned long seqStartTime = 0;
+static SeqHandler seqNoteOn = 0;
+static SeqHandler seqNoteOff = 0;
+
+// Next event boundary: the event starting there and its song tick
+static SoftTimer seqTimer;
+static unsigned int seqNext = 0;
+static unsigned long seqNextTick = 0;
+
+// Event found by the previous seqEventAt call, to continue the search from
+static unsigned int lookupEvent = 0;
+static unsigned long lookupTick = 0;
+
+// Returns the ACLK ticks taken by count song ticks at bpm, rounded down.
+// Whole multiples are split off first so the products fit in 32 bits.
+static unsigned long songTicksToTime(unsigned long count, unsigned int bpm)
+{
+    unsigned long divisor = (unsigned long)bpm * SEQ_TICKS_PER_BEAT;
+    unsigned long whole = ticksPerMinute / divisor;
+    unsigned long rest = ticksPerMinute % divisor;
+
+    return count * whole + (count * rest) / divisor;
+}
+
+// Returns the time a song tick starts at, walking the tempo map from the
+// start of the song
+unsigned long seqTickTime(unsigned long tick)
+{
+    const TempoChange *tempo = seqSong->tempo;
+    unsigned long time = seqStartTime;
+    unsigned int i;
+
+    for (i = 0; i + 1 < seqSong->tempoCount && tempo[i + 1].tick < tick; i++) {
+        time += songTicksToTime(tempo[i + 1].tick - tempo[i].tick, tempo[i].bpm);
+    }
+    return time + songTicksToTime(tick - tempo[i].tick, tempo[i].bpm);
+}
+
+static void seqBoundary(SoftTimer *timer);
+
+// Schedules the boundary at the start of event seqNext, at its exact time
+static void seqSchedule(void)
+{
+    timerSetAt(&seqTimer, seqTickTime(seqNextTick), 0, seqBoundary);
+}
+
+// Event boundary: ends the previous event and starts the next one
+static void seqBoundary(SoftTimer *timer)
+{
+    if (seqNext > 0 && seqNoteOff) {
+        seqNoteOff(seqNext - 1);
+    }
+    if (seqNext == seqSong->eventCount) {
+        return;
+    }
+
+    if (seqNoteOn) {
+        seqNoteOn(seqNext);
+    }
+    seqNextTick += songEventLength(&seqSong->events[seqNext]);
+    seqNext++;
+
+    seqSchedule();
+}
+
+// Starts playing a song from its first event at startTime
+void seqStart(const Song *song, unsigned long startTime, SeqHandler noteOn, SeqHandler noteOff)
+{
+    seqStop();
+
+    seqSong = song;
+    seqStartTime = startTime;
+    seqNoteOn = noteOn;
+    seqNoteOff = noteOff;
+    seqNext = 0;
+    seqNextTick = 0;
+    lookupEvent = 0;
+    lookupTick = 0;
+
+    seqSchedule();
+}
+
+// Stops the song without calling the note off handler
+void seqStop(void)
+{
+    timerCancel(&seqTimer);
+}
+
+// Returns the length of the song in song ticks
+unsigned long seqLength(void)
+{
+    unsigned long length = 0;
+    unsigned int i;
+
+    for (i = 0; i < seqSong->eventCount; i++) {
+        length += songEventLength(&seqSong->events[i]);
+    }
+    return length;
+}
+
+// Returns the index of the event playing at a song tick, and sets startTick
+// to the tick it starts at, or returns -1 after the end of the song. The
+// search continues from the previous call, so looking up ticks in order
+// takes constant time per tick.
+int seqEventAt(unsigned long tick, unsigned long *startTick)
+{
+    const SongEvent *events = seqSong->events;
+
+    if (tick < lookupTick) {
+        lookupEvent = 0;
+        lookupTick = 0;
+    }
+
+    while (lookupEvent < seqSong->eventCount && tick >= lookupTick + songEventLength(&events[lookupEvent])) {
+        lookupTick += songEventLength(&events[lookupEvent]);
+        lookupEvent++;
+    }
+
+    if (lookupEvent == seqSong->eventCount) {
+        return -1;
+    }
+    *startTick = lookupTick;
+    return lookupEvent;
+}
@@ -0,0 +1,63 @@
+/*
+ * sequencer.h
+ *
+ * Tempo based song sequencer.
+ *
+ * A song is a list of events, each a note (or a rest) lasting a number of
+ * song ticks, played against a tempo map. Note on and note off are scheduled
+ * on a software timer at the exact time of each event boundary, computed from
+ * the tempo map from the start of the song so rounding never accumulates.
+ */
+
+#ifndef SEQUENCER_H_
+#define SEQUENCER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "timebase.h"
+
+// Song ticks per beat (quarter note), so one tick is an eighth note
+#define SEQ_TICKS_PER_BEAT  2
+
+// One note or rest of a song, packed into two bytes so songs can be const
+// tables in flash: the MIDI note number (0 for a rest), then the lanes the
+// note is played on in the upper four bits and its length minus one in the
+// lower four. Anything else about a note is looked up from these.
+typedef struct SongEvent {
+    uint8_t note;
+    uint8_t lanesLength;
+} SongEvent;
+
+// Builds a song event, with lanes a bitmask of lanes 0-3 (0 for a rest) and
+// length 1-16 song ticks
+#define SONG_EVENT(note, lanes, length)  {(note), ((lanes) << 4) | ((length) - 1)}
+#define SONG_REST(length)                SONG_EVENT(0, 0, length)
+
+#define songEventNote(event)    ((event)->note)
+#define songEventLanes(event)   ((event)->lanesLength >> 4)
+#define songEventLength(event)  (((event)->lanesLength & 0x0F) + 1)
+
+// Tempo from a song tick on, until the next change
+typedef struct TempoChange {
+    unsigned int tick;
+    unsigned int bpm;       // beats (quarter notes) per minute
+} TempoChange;
+
+typedef struct Song {
+    const SongEvent *events;
+    unsigned int eventCount;
+    const TempoChange *tempo;   // in order of tick, the first at tick 0
+    unsigned int tempoCount;
+} Song;
+
+// Called at the start and at the end of each event, with its index
+typedef void (*SeqHandler)(int index);
+
+// Prototypes for functions implemented in sequencer.c
+void seqStart(const Song *song, unsigned long startTime, SeqHandler noteOn, SeqHandler noteOff);
+void seqStop(void);
+unsigned long seqTickTime(unsigned long tick);
+unsigned long seqLength(void);
+int seqEventAt(unsigned long tick, unsigned long *startTick);
+
+#endif /* SEQUENCER_H_ */
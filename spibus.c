@@ -0,0 +1,410 @@
+/*
+ * spibus.c
+ *
+ * Arbiter for USCI_B0, see spibus.h.
+ *
+ * Bytes are written from the UCB0TXIFG interrupt. With USE_DMA_FLUSH, LCD runs
+ * of more than one byte are handed to DMA channel 0 and the TX interrupt is
+ * enabled again from the DMA interrupt once the run has been loaded. The two
+ * bytes of a DAC write are left to the TX interrupt, where setting up the DMA
+ * would take longer than sending them. A
+ * preemptible transaction is sent in runs of its split length, so the TX
+ * interrupt sees each byte boundary where it may be preempted. A split point
+ * needs at least split bytes before it since the chip select was asserted and
+ * at least split bytes after it in the block, so a transaction is never closed
+ * right after its header or just before its last short block.
+ *
+ * Closing a transaction, at its end or to preempt it, uses the RX interrupt to
+ * find out when the shifter is idle so the chip select can be released. UCB0
+ * is only set up again when the next transaction is for another device.
+ */
+
+#include "spibus.h"
+#include "timebase.h"
+
+#ifdef USE_SPI_TX_QUEUE
+
+typedef struct SpiDevice {
+    uint8_t ctl0;           // UCCKPH and UCCKPL bits
+    uint16_t clockTicks;    // SMCLK cycles per bit
+} SpiDevice;
+
+// Both chips take data on the rising edge of a clock idling low
+static const SpiDevice devices[SPI_DEVICES] = {
+    { UCCKPH, SPI_CLK_TICKS },      // SPI_DEVICE_LCD
+    { UCCKPH, DAC_SPI_CLK_TICKS },  // SPI_DEVICE_DAC
+};
+
+static SpiTransaction queues[SPI_PRIORITIES][SPI_QUEUE_SIZE];
+static volatile uint8_t heads[SPI_PRIORITIES];
+static volatile uint8_t tails[SPI_PRIORITIES];
+
+// The transaction at the tail of a queue was preempted and resumes with its
+// header
+static bool suspended[SPI_PRIORITIES];
+
+#define queueCount(p)   ((uint8_t)(heads[p] - tails[p]))
+
+static bool active = false;         // a transaction holds the bus
+static uint8_t activePriority;      // queue of the transaction holding it
+static bool resuming;               // its header has to be sent first
+static bool preempting;             // it is being closed to let others go
+static uint16_t run;                // bytes sent since its chip select
+static uint16_t chunk;              // bytes left in the current run
+
+// Device UCB0 is set up for, none until the first transaction
+static uint8_t configured = SPI_DEVICES;
+
+static SpiBusGuard guard = 0;
+static bool held = false;           // the guard refused the next split
+
+// SMCLK cycles a number of bytes takes on a device
+static uint16_t busTicks(uint8_t device, uint16_t bytes)
+{
+    return bytes * 8 * devices[device].clockTicks;
+}
+
+static void selectDevice(uint8_t device)
+{
+    if (device == SPI_DEVICE_LCD) {
+        AssertCS();
+    }
+    else {
+        DAC_PORT_CS_OUT &= ~DAC_PIN_CS;
+    }
+}
+
+static void deselectDevice(uint8_t device)
+{
+    if (device == SPI_DEVICE_LCD) {
+        // Ensure a 2us min delay to meet the LCD's thSCS
+        __delay_cycles(SYSTEM_CLOCK_SPEED * 0.000002);
+        DeassertCS();
+    }
+    else {
+        DAC_PORT_CS_OUT |= DAC_PIN_CS;
+    }
+}
+
+// Starts or resumes the first transaction of the highest priority waiting,
+// unless the guard holds it back. Must be called with interrupts disabled and
+// the bus idle.
+static void startNext(void)
+{
+    SpiTransaction *t;
+    const SpiDevice *d;
+    uint8_t p;
+
+    for (p = 0; p < SPI_PRIORITIES; p++) {
+        if (queueCount(p)) {
+            break;
+        }
+    }
+    if (p == SPI_PRIORITIES) {
+        return;
+    }
+    t = &queues[p][tails[p] & (SPI_QUEUE_SIZE - 1)];
+
+    // room for the header, a run and the trailer
+    if (p != SPI_PRIORITY_HIGH && t->split && guard) {
+        if (held || !guard(busTicks(t->device, t->split + 2))) {
+            held = true;
+            return;
+        }
+    }
+
+    if (configured != t->device) {
+        d = &devices[t->device];
+        SPI_REG_CTL1 |= UCSWRST;
+        SPI_REG_CTL0 = (SPI_REG_CTL0 & ~(UCCKPH | UCCKPL)) | d->ctl0;
+        SPI_REG_BRL = d->clockTicks & 0xFF;
+        SPI_REG_BRH = (d->clockTicks >> 8) & 0xFF;
+        SPI_REG_CTL1 &= ~UCSWRST;
+        configured = t->device;
+    }
+
+    active = true;
+    activePriority = p;
+    resuming = suspended[p];
+    run = 0;
+    chunk = 0;
+
+    selectDevice(t->device);
+
+    // The TX buffer is empty, but reading UCB0IV may have cleared its flag,
+    // so raise it by hand to get the first interrupt
+    SPI_REG_IFG |= UCTXIFG;
+    SPI_REG_IE = (SPI_REG_IE & ~UCRXIE) | UCTXIE;
+}
+
+// Returns true if the active transaction has to give up the bus at a split
+// point before sending a number of bytes
+static bool mustYield(const SpiTransaction *t, uint16_t bytes)
+{
+    uint8_t p;
+
+    for (p = 0; p < activePriority; p++) {
+        if (queueCount(p)) {
+            return true;
+        }
+    }
+    // the run and the trailer closing it if it is preempted next time
+    if (activePriority != SPI_PRIORITY_HIGH && guard &&
+        !guard(busTicks(t->device, bytes + 1))) {
+        held = true;
+        return true;
+    }
+    return false;
+}
+
+// Returns true while a transaction is queued or being sent, which needs SMCLK
+static bool spiBusBusy(void)
+{
+    return !spiBusIdle();
+}
+
+// Registers the bus as an SMCLK user, once UCB0 has been set up
+void spiBusInit(void)
+{
+    timeSmclkUser(spiBusBusy);
+}
+
+// Adds a copy of a transaction to the queue of a priority. May be called from
+// thread or interrupt context. Returns false if the queue is full.
+bool spiBusQueue(uint8_t priority, const SpiTransaction *transaction)
+{
+    unsigned short state = __get_interrupt_state();
+
+    __disable_interrupt();
+
+    if (queueCount(priority) >= SPI_QUEUE_SIZE) {
+        __set_interrupt_state(state);
+        return false;
+    }
+
+    queues[priority][heads[priority] & (SPI_QUEUE_SIZE - 1)] = *transaction;
+    heads[priority]++;
+
+    if (!active) {
+        startNext();
+    }
+
+    __set_interrupt_state(state);
+    return true;
+}
+
+// Queues two bytes for a device, copied so they need not outlive the call.
+// The transaction cannot be preempted. Returns false if the queue is full.
+bool spiBusSend(uint8_t priority, uint8_t device, uint8_t first,
+                uint8_t second, void (*done)(void))
+{
+    SpiTransaction *t;
+    unsigned short state = __get_interrupt_state();
+
+    __disable_interrupt();
+
+    if (queueCount(priority) >= SPI_QUEUE_SIZE) {
+        __set_interrupt_state(state);
+        return false;
+    }
+
+    t = &queues[priority][heads[priority] & (SPI_QUEUE_SIZE - 1)];
+    t->bytes[0] = first;
+    t->bytes[1] = second;
+    t->data = t->bytes;
+    t->length = 2;
+    t->nextBlock = 0;
+    t->done = done;
+    t->split = 0;
+    t->device = device;
+    heads[priority]++;
+
+    if (!active) {
+        startNext();
+    }
+
+    __set_interrupt_state(state);
+    return true;
+}
+
+// Returns true if nothing is queued or being sent
+bool spiBusIdle(void)
+{
+    uint8_t p;
+
+    for (p = 0; p < SPI_PRIORITIES; p++) {
+        if (queueCount(p)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Returns true if nothing is queued or being sent for a device
+bool spiBusDeviceIdle(uint8_t device)
+{
+    uint8_t p, i;
+    bool idle = true;
+    unsigned short state = __get_interrupt_state();
+
+    __disable_interrupt();
+    for (p = 0; p < SPI_PRIORITIES; p++) {
+        for (i = tails[p]; i != heads[p]; i++) {
+            if (queues[p][i & (SPI_QUEUE_SIZE - 1)].device == device) {
+                idle = false;
+            }
+        }
+    }
+    __set_interrupt_state(state);
+    return idle;
+}
+
+// Sets the guard consulted before each split of a preemptible transaction
+// below SPI_PRIORITY_HIGH, or 0 for none, and lets a held transaction go on
+void spiBusSetGuard(SpiBusGuard newGuard)
+{
+    unsigned short state = __get_interrupt_state();
+
+    __disable_interrupt();
+    guard = newGuard;
+    held = false;
+    if (!active) {
+        startNext();
+    }
+    __set_interrupt_state(state);
+}
+
+//------------------------------------------------------------------------------
+// USCI_B0 Interrupt Service Routine
+//------------------------------------------------------------------------------
+#pragma vector=USCI_B0_VECTOR
+__interrupt void USCI_B0_ISR(void)
+{
+    SpiTransaction *t = &queues[activePriority][tails[activePriority] & (SPI_QUEUE_SIZE - 1)];
+#ifdef USE_DMA_FLUSH
+    const uint8_t *first;
+#endif
+    void (*done)(void);
+    bool wake = false;
+
+    switch (__even_in_range(UCB0IV, 4)) {
+    case 4: // UCTXIFG
+        if (resuming) {
+            resuming = false;
+            run = 1;
+            SPI_REG_TXBUF = t->header;
+            break;
+        }
+
+        if (chunk == 0) {
+            if (t->length == 0 && t->nextBlock) {
+                t->length = t->nextBlock(&t->data);
+            }
+            if (t->length == 0) {
+                // Last byte written, wait for it to leave the shifter
+                SPI_REG_IE = (SPI_REG_IE & ~UCTXIE) | UCRXIE;
+                break;
+            }
+
+            // a run ends mid block only where a whole run is left after it
+            chunk = t->length;
+            if (t->split && chunk >= 2 * t->split) {
+                chunk = t->split;
+            }
+
+            if (t->split && run >= t->split && t->length >= t->split &&
+                mustYield(t, chunk)) {
+                chunk = 0;
+                preempting = true;
+                SPI_REG_TXBUF = t->trailer;
+                SPI_REG_IE = (SPI_REG_IE & ~UCTXIE) | UCRXIE;
+                break;
+            }
+            t->length -= chunk;
+        }
+
+#ifdef USE_DMA_FLUSH
+        if (chunk > 1 && t->device == SPI_DEVICE_LCD) {
+            // The DMA takes the rest of the run from the next TX flag edge
+            first = t->data;
+            t->data += chunk;
+            run += chunk;
+            SPI_REG_IE &= ~UCTXIE;
+            StartLcdDma(first + 1, chunk - 1);
+            chunk = 0;
+            SPI_REG_TXBUF = *first;
+            break;
+        }
+#endif
+        chunk--;
+        run++;
+        SPI_REG_TXBUF = *t->data++;
+        break;
+
+    case 2: // UCRXIFG
+        // Reading RXBUF first means a byte still shifting out raises
+        // UCRXIFG again once it is done
+        (void)SPI_REG_RXBUF;
+        if (SPI_REG_STAT & UCBUSY) {
+            break;
+        }
+
+        SPI_REG_IE &= ~UCRXIE;
+        deselectDevice(t->device);
+        active = false;
+
+        if (preempting) {
+            preempting = false;
+            suspended[activePriority] = true;
+        }
+        else {
+            // the slot may be reused as soon as the tail moves on
+            done = t->done;
+            suspended[activePriority] = false;
+            tails[activePriority]++;
+            if (activePriority == SPI_PRIORITY_HIGH) {
+                held = false;
+            }
+            else {
+                wake = true;
+            }
+            if (done) {
+                done();
+            }
+        }
+
+        if (!active) {
+            startNext();
+        }
+
+        // Let the main loop run if it is waiting in a low power mode
+        if (wake) {
+            __bic_SR_register_on_exit(LPM0_bits);
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+#ifdef USE_DMA_FLUSH
+//------------------------------------------------------------------------------
+// DMA Interrupt Service Routine
+//------------------------------------------------------------------------------
+#pragma vector=DMA_VECTOR
+__interrupt void DMA_ISR(void)
+{
+    switch (__even_in_range(DMAIV, 16)) {
+    case DMAIV_DMA0IFG:
+        // The run has been loaded, so hand the bus back to the TX interrupt
+        // which raises as soon as the last byte moves to the shifter
+        SPI_REG_IE |= UCTXIE;
+        break;
+    default:
+        break;
+    }
+}
+#endif
+
+#endif /* USE_SPI_TX_QUEUE */
@@ -0,0 +1,77 @@
+/*
+ * spibus.h
+ *
+ * Arbiter for USCI_B0, shared by the Sharp LCD and the MCP4921 DAC.
+ *
+ * Transactions wait in one queue per priority and are sent from the USCI_B0
+ * and DMA interrupts. Before a transaction starts, the clock phase, polarity
+ * and rate of its device are set up and its chip select is asserted. A
+ * transaction is a series of blocks of bytes: the first one is given when it
+ * is queued, the following ones come from its nextBlock function until that
+ * returns 0.
+ *
+ * A transaction with a split length can be preempted at the start of each
+ * block and every split bytes into it. If a higher priority transaction is
+ * waiting at such a byte boundary, the trailer byte closes the transaction,
+ * its chip select is released and the higher priority transactions are sent.
+ * It then resumes where it stopped, after sending its header byte again. The
+ * LCD flush splits at its rows, which the panel only takes whole, so a DAC
+ * write never waits for more than one row of a full frame flush.
+ *
+ * A guard function can also hold back preemptible transactions until the next
+ * higher priority transaction has been sent, when the next split would not
+ * end in time for it. The audio engine uses it so a row never makes a DAC
+ * write miss its sample.
+ */
+
+#ifndef SPIBUS_H_
+#define SPIBUS_H_
+
+#include <msp430.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "peripherals.h"
+
+#ifdef USE_SPI_TX_QUEUE
+
+// Devices on the bus
+#define SPI_DEVICE_LCD      0
+#define SPI_DEVICE_DAC      1
+#define SPI_DEVICES         2
+
+// Priorities, the lowest number goes first
+#define SPI_PRIORITY_HIGH   0   // DAC samples
+#define SPI_PRIORITY_NORMAL 1   // LCD commands and flushes
+#define SPI_PRIORITIES      2
+
+// Number of transactions each priority can queue, must be a power of 2
+#define SPI_QUEUE_SIZE      4
+
+typedef struct SpiTransaction {
+    const uint8_t *data;    // next byte to send
+    uint16_t length;        // bytes left in the block
+    uint16_t (*nextBlock)(const uint8_t **data); // supplies more blocks, or 0
+    void (*done)(void);     // called after the chip select is released, or 0
+    uint16_t split;         // bytes between preemption points, 0 for none
+    uint8_t header;         // sent again when a preempted transaction resumes
+    uint8_t trailer;        // sent to close a transaction being preempted
+    uint8_t device;         // SPI_DEVICE_x
+    uint8_t bytes[2];       // storage for the data of spiBusSend()
+} SpiTransaction;
+
+// Told the SMCLK cycles the next part of a preemptible transaction takes,
+// returns false to hold it back until a higher priority transaction is sent
+typedef bool (*SpiBusGuard)(uint16_t ticks);
+
+// Prototypes for functions implemented in spibus.c
+void spiBusInit(void);
+bool spiBusQueue(uint8_t priority, const SpiTransaction *transaction);
+bool spiBusSend(uint8_t priority, uint8_t device, uint8_t first,
+                uint8_t second, void (*done)(void));
+bool spiBusIdle(void);
+bool spiBusDeviceIdle(uint8_t device);
+void spiBusSetGuard(SpiBusGuard guard);
+
+#endif /* USE_SPI_TX_QUEUE */
+
+#endif /* SPIBUS_H_ */
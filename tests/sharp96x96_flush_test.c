@@ -0,0 +1,185 @@
+/*
+ * sharp96x96_flush_test.c
+ *
+ * Checks Sharp96x96_FlushByteCount on the host: a flush sends the command
+ * byte, 14 bytes per dirty row (line address, 12 data bytes and trailer) and
+ * the final trailer, so a full frame is 1346 bytes and a clean buffer sends
+ * nothing. Sharp96x96.c is built as configured, against a stand-in for the
+ * LCD queue of its HAL that sends the transactions when the test runs the
+ * bus.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "grlib.h"
+#include "Sharp96x96.h"
+#include "HAL_MSP_EXP430FR5529_Sharp96x96.h"
+
+#define QUEUE_SIZE  4
+
+typedef struct Transaction {
+    uint16_t length;
+    uint16_t (*nextBlock)(const uint8_t **data);
+    void (*done)(void);
+    uint8_t last;
+} Transaction;
+
+static Transaction queue[QUEUE_SIZE];
+static uint8_t queued = 0;
+static unsigned long streamBytes;   // bytes sent by the last flush
+static uint8_t streamLast;          // last byte it sent
+
+static int failures = 0;
+
+uint8_t Sharp96x96_QueueStream(const uint8_t *pucData, uint16_t uiLength,
+        uint16_t (*pfnNextBlock)(const uint8_t **ppucData),
+        void (*pfnDone)(void), uint16_t uiSplit)
+{
+    (void)uiSplit;
+    if (queued == QUEUE_SIZE) {
+        return 0;
+    }
+    queue[queued].length = uiLength;
+    queue[queued].nextBlock = pfnNextBlock;
+    queue[queued].done = pfnDone;
+    queue[queued].last = pucData[uiLength - 1];
+    queued++;
+    return 1;
+}
+
+uint8_t Sharp96x96_QueueCommand(uint8_t ucCommand, void (*pfnDone)(void))
+{
+    (void)ucCommand;
+    if (queued == QUEUE_SIZE) {
+        return 0;
+    }
+    queue[queued].length = 2;
+    queue[queued].nextBlock = 0;
+    queue[queued].done = pfnDone;
+    queue[queued].last = SHARP_LCD_TRAILER_BYTE;
+    queued++;
+    return 1;
+}
+
+// Sends the queued transactions in order, as the USCI_B0 interrupt would
+void testRunBus(void)
+{
+    Transaction t;
+    const uint8_t *data;
+    uint16_t length;
+    uint8_t i;
+
+    while (queued) {
+        t = queue[0];
+        for (i = 1; i < queued; i++) {
+            queue[i - 1] = queue[i];
+        }
+        queued--;
+
+        if (t.nextBlock) {
+            streamBytes = t.length;
+            streamLast = t.last;
+            while ((length = t.nextBlock(&data)) != 0) {
+                streamBytes += length;
+                streamLast = data[length - 1];
+            }
+        }
+        if (t.done) {
+            t.done();
+        }
+    }
+}
+
+// Only reached for fonts the driver does not draw itself
+void Graphics_drawString(const Graphics_Context *context, uint8_t *string,
+        int32_t length, int32_t x, int32_t y, bool opaque)
+{
+    abort();
+}
+
+void Graphics_drawStringCentered(const Graphics_Context *context,
+        uint8_t *string, int32_t length, int32_t x, int32_t y, bool opaque)
+{
+    abort();
+}
+
+static void flushAndCheck(const char *name, uint16_t expected)
+{
+    g_sharp96x96LCD.callFlush(g_sharp96x96LCD.displayData);
+    testRunBus();
+
+    if (Sharp96x96_FlushByteCount != expected) {
+        printf("FAIL %s: %u bytes, expected %u\n", name,
+               Sharp96x96_FlushByteCount, expected);
+        failures++;
+    }
+    else if (expected && (streamBytes != expected ||
+                          streamLast != SHARP_LCD_TRAILER_BYTE)) {
+        printf("FAIL %s: %lu bytes sent, expected %u ending with the trailer\n",
+               name, streamBytes, expected);
+        failures++;
+    }
+    else {
+        printf("ok   %s: %u bytes\n", name, expected);
+    }
+}
+
+// Display driver color, as the graphics library passes it on
+static uint16_t color(uint32_t value)
+{
+    return g_sharp96x96LCD.callColorTranslate(g_sharp96x96LCD.displayData, value);
+}
+
+static void clearScreen(uint32_t value)
+{
+    g_sharp96x96LCD.callClearDisplay(g_sharp96x96LCD.displayData, color(value));
+    testRunBus();
+}
+
+int main(void)
+{
+    Graphics_Rectangle screen = { 0, 0, LCD_HORIZONTAL_MAX - 1, LCD_VERTICAL_MAX - 1 };
+    int16_t n, i;
+
+    clearScreen(ClrWhite);
+    flushAndCheck("clean buffer", 0);
+
+    // One pixel per panel row, on separate rows and in runs of adjacent rows
+    for (n = 1; n <= 8; n++) {
+        for (i = 0; i < n; i++) {
+            g_sharp96x96LCD.callPixelDraw(g_sharp96x96LCD.displayData,
+                                          (i * 11) % LCD_HORIZONTAL_MAX,
+                                          (i * 11) % LCD_VERTICAL_MAX,
+                                          color(ClrBlack));
+        }
+        printf("     %d dirty rows\n", n);
+        flushAndCheck("separate rows", 2 + 14 * n);
+        flushAndCheck("unchanged", 0);
+
+        for (i = 0; i < n; i++) {
+            g_sharp96x96LCD.callPixelDraw(g_sharp96x96LCD.displayData,
+                                          LCD_HORIZONTAL_MAX - 1 - i,
+                                          LCD_VERTICAL_MAX - 1 - i,
+                                          color(ClrBlack));
+        }
+        flushAndCheck("adjacent rows", 2 + 14 * n);
+        clearScreen(ClrWhite);
+    }
+
+    g_sharp96x96LCD.callRectFill(g_sharp96x96LCD.displayData, &screen, color(ClrBlack));
+    flushAndCheck("full frame", 1346);
+    flushAndCheck("unchanged", 0);
+
+    // The clear command leaves the panel white, so a black buffer is resent
+    clearScreen(ClrBlack);
+    flushAndCheck("cleared to black", 1346);
+    clearScreen(ClrWhite);
+    flushAndCheck("cleared to white", 0);
+
+    if (failures) {
+        printf("%d failed\n", failures);
+        return 1;
+    }
+    printf("all passed\n");
+    return 0;
+}
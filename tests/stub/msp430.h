@@ -0,0 +1,26 @@
+/*
+ * msp430.h
+ *
+ * Host stand-in for the compiler's device header, with just what the LCD
+ * driver needs to build on a PC. Interrupts are always enabled and going to
+ * sleep runs the test's bus model instead.
+ */
+
+#ifndef TEST_MSP430_H_
+#define TEST_MSP430_H_
+
+#include <stdint.h>
+
+#define GIE         (0x0008)
+#define LPM0_bits   (0x0010)
+
+// Completes the queued SPI transactions, defined by the test
+void testRunBus(void);
+
+static inline unsigned short __get_interrupt_state(void) { return GIE; }
+static inline void __set_interrupt_state(unsigned short state) { (void)state; }
+static inline void __disable_interrupt(void) { }
+static inline void __enable_interrupt(void) { }
+static inline void __bis_SR_register(unsigned short bits) { (void)bits; testRunBus(); }
+
+#endif /* TEST_MSP430_H_ */
@@ -0,0 +1,472 @@
+/*
+ * timebase.c
+ *
+ * Tickless time service on Timer A2, see timebase.h.
+ */
+
+#include "timebase.h"
+
+// Number of TA2 overflows, the upper 16 bits of the time
+static volatile unsigned int timeHigh = 0;
+
+// Time the CPU should wake up at, while wakeArmed is set
+static unsigned long nextWake = 0;
+static volatile bool wakeArmed = false;
+
+// Period in ticks and function of each sampler, on CCR1 and CCR2
+static unsigned int samplerPeriod[TIME_SAMPLERS];
+static TimeSampler samplerFunction[TIME_SAMPLERS];
+
+// Functions telling whether SMCLK has to keep running
+static TimeSmclkUser smclkUsers[TIME_SMCLK_USERS];
+static uint8_t smclkUserCount = 0;
+
+// Time spent in timeSleepUntil, for timeAwakePercent
+static unsigned long asleepTicks = 0;
+static unsigned long lastLoadTime = 0;
+
+// Starts TA2 counting ACLK in continuous mode with only the overflow interrupt
+void timeInit(void)
+{
+    TA2CTL = TASSEL_1 + ID_0 + MC_0 + TACLR;
+    TA2CCTL0 = 0;
+    timeHigh = 0;
+    TA2CTL = TASSEL_1 + ID_0 + MC_2 + TACLR + TAIE;
+}
+
+// Reads TA2R. ACLK is not synchronous to MCLK, so the count is read until two
+// reads in a row agree
+static unsigned int readCounter(void)
+{
+    unsigned int a, b;
+
+    b = TA2R;
+    do {
+        a = b;
+        b = TA2R;
+    } while (a != b);
+
+    return a;
+}
+
+// Returns the time in ACLK ticks since timeInit. The overflow count and the
+// counter are read together with interrupts disabled, so the result is never
+// torn by the overflow interrupt, and this is safe to call from any interrupt
+// service routine. The live counter gives a resolution of about 30.5 us.
+unsigned long timeNow(void)
+{
+    unsigned int high, low;
+    unsigned short state = __get_interrupt_state();
+
+    __disable_interrupt();
+    high = timeHigh;
+    low = readCounter();
+
+    // Counter wrapped but the overflow interrupt has not run yet
+    if ((TA2CTL & TAIFG) && low < 0x8000) {
+        high++;
+    }
+    __set_interrupt_state(state);
+
+    return ((unsigned long)high << 16) | low;
+}
+
+// Returns the time in us since timeInit, wrapping after about 71 minutes
+unsigned long timeMicros(void)
+{
+    return timeTicksToUs(timeNow());
+}
+
+// Returns the time in ms since timeInit, wrapping after about 36 hours
+unsigned long timeMillis(void)
+{
+    return timeTicksToMs(timeNow());
+}
+
+// Converts ticks to us, us = ticks * 15625 / 512. The whole multiples of 512
+// ticks are converted separately so the product cannot overflow.
+unsigned long timeTicksToUs(unsigned long ticks)
+{
+    return (ticks >> 9) * 15625UL + (((ticks & 511) * 15625UL) >> 9);
+}
+
+// Converts ticks to ms, ms = ticks * 125 / 4096
+unsigned long timeTicksToMs(unsigned long ticks)
+{
+    return (ticks >> 12) * 125UL + (((ticks & 4095) * 125UL) >> 12);
+}
+
+// Converts us to ticks, ticks = us * 512 / 15625 rounded up
+unsigned long timeUsToTicks(unsigned long us)
+{
+    return (us / 15625UL) * 512UL + ((us % 15625UL) * 512UL + 15624UL) / 15625UL;
+}
+
+// Converts ms to ticks, ticks = ms * 4096 / 125 rounded up
+unsigned long timeMsToTicks(unsigned long ms)
+{
+    return (ms / 125UL) * 4096UL + ((ms % 125UL) * 4096UL + 124UL) / 125UL;
+}
+
+// Points CCR0 at the wake up time if it falls before the next overflow.
+// Returns true if the wake up time has already been reached.
+// Must be called with interrupts disabled.
+static bool armCompare(void)
+{
+    unsigned long now = timeNow();
+
+    if (timeReached(now, nextWake)) {
+        return true;
+    }
+
+    if ((unsigned int)(nextWake >> 16) == (unsigned int)(now >> 16)) {
+        TA2CCR0 = (unsigned int)nextWake;
+        TA2CCTL0 = CCIE;
+
+        // The counter may have passed CCR0 while it was being set
+        return timeReached(timeNow(), nextWake);
+    }
+
+    // Later overflows arm CCR0 once the wake up time is within reach
+    TA2CCTL0 = 0;
+    return false;
+}
+
+// Returns true if any registered module needs SMCLK
+static bool smclkNeeded(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < smclkUserCount; i++) {
+        if (smclkUsers[i]()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Sleeps until wakeTime or until any interrupt service routine wakes the CPU.
+// LPM3 stops SMCLK, so the CPU only sleeps in LPM0 while a module registered
+// with timeSmclkUser() needs it.
+// May be called with interrupts disabled: they stay disabled until the CPU
+// is asleep, so the caller can check for pending work right before.
+void timeSleepUntil(unsigned long wakeTime)
+{
+    unsigned long sleepStart;
+
+    __disable_interrupt();
+
+    nextWake = wakeTime;
+    wakeArmed = true;
+
+    if (armCompare()) {
+        wakeArmed = false;
+        TA2CCTL0 = 0;
+        __enable_interrupt();
+        return;
+    }
+
+    sleepStart = timeNow();
+
+    if (smclkNeeded()) {
+        __bis_SR_register(LPM0_bits + GIE);
+    }
+    else {
+        __bis_SR_register(LPM3_bits + GIE);
+    }
+    __no_operation();
+
+    __disable_interrupt();
+    asleepTicks += timeNow() - sleepStart;
+    wakeArmed = false;
+    TA2CCTL0 = 0;
+    __enable_interrupt();
+}
+
+// Returns the share of time the CPU was awake since the previous call, in
+// percent. Interrupt service routines that run while the main loop sleeps
+// count as asleep, so this is the load of the main loop.
+unsigned int timeAwakePercent(void)
+{
+    unsigned long now = timeNow();
+    unsigned long elapsed = now - lastLoadTime;
+    unsigned long awake = elapsed - asleepTicks;
+    unsigned int percent = 0;
+
+    if (elapsed) {
+        // scaled down first so awake * 100 cannot overflow
+        while (elapsed > 0xFFFFFFUL) {
+            elapsed >>= 1;
+            awake >>= 1;
+        }
+        percent = (unsigned int)((awake * 100) / elapsed);
+    }
+
+    asleepTicks = 0;
+    lastLoadTime = now;
+    return percent;
+}
+
+// Starts calling sampler every period ticks from the interrupt of CCR1
+// (channel 0) or CCR2 (channel 1), the first time one period from now
+void timeSamplerStart(uint8_t channel, unsigned int period, TimeSampler sampler)
+{
+    volatile unsigned int *cctl = channel ? &TA2CCTL2 : &TA2CCTL1;
+    volatile unsigned int *ccr = channel ? &TA2CCR2 : &TA2CCR1;
+
+    *cctl = 0;
+    samplerPeriod[channel] = period;
+    samplerFunction[channel] = sampler;
+    *ccr = readCounter() + period;
+    *cctl = CCIE;
+}
+
+// Changes the period of a running sampler. Called from the sampler itself, the
+// new period already counts from the sample being taken.
+void timeSamplerSetPeriod(uint8_t channel, unsigned int period)
+{
+    samplerPeriod[channel] = period;
+}
+
+// Stops a sampler
+void timeSamplerStop(uint8_t channel)
+{
+    if (channel) {
+        TA2CCTL2 = 0;
+    }
+    else {
+        TA2CCTL1 = 0;
+    }
+}
+
+// Registers a function returning true while its module needs SMCLK, which
+// keeps timeSleepUntil() out of LPM3. Registering a function again does
+// nothing.
+void timeSmclkUser(TimeSmclkUser needsSmclk)
+{
+    uint8_t i;
+    unsigned short state = __get_interrupt_state();
+
+    __disable_interrupt();
+    for (i = 0; i < smclkUserCount; i++) {
+        if (smclkUsers[i] == needsSmclk) {
+            break;
+        }
+    }
+    if (i == smclkUserCount && smclkUserCount < TIME_SMCLK_USERS) {
+        smclkUsers[smclkUserCount++] = needsSmclk;
+    }
+    __set_interrupt_state(state);
+}
+
+// Calls a sampler and sets its compare register for the next sample. The time
+// the sample was due at is rebuilt from the compare value, so it does not
+// depend on the interrupt latency. Returns what the sampler returns.
+static bool runSampler(uint8_t channel, volatile unsigned int *ccr)
+{
+    unsigned long now = timeNow();
+    unsigned long sampleTime = now - (unsigned int)((unsigned int)now - *ccr);
+    bool wake = samplerFunction[channel](sampleTime);
+
+    // after the call, so the sampler can change its own period
+    *ccr = (unsigned int)sampleTime + samplerPeriod[channel];
+
+    // a sample running late would otherwise wait a whole counter wrap
+    if ((int)(*ccr - readCounter()) <= 0) {
+        *ccr = readCounter() + samplerPeriod[channel];
+    }
+    return wake;
+}
+
+// TIMER A2 CCR0 INTERRUPT
+// The wake up time has been reached
+#pragma vector = TIMER2_A0_VECTOR
+__interrupt void Timer_A2_ISR(void)
+{
+    TA2CCTL0 = 0;
+    __bic_SR_register_on_exit(LPM3_bits);
+}
+
+// TIMER A2 OVERFLOW AND SAMPLER INTERRUPT
+// Runs the samplers, extends the count and arms CCR0 when the wake up time
+// comes within reach
+#pragma vector = TIMER2_A1_VECTOR
+__interrupt void Timer_A2_Overflow_ISR(void)
+{
+    switch (__even_in_range(TA2IV, TA2IV_TA2IFG)) {
+    case TA2IV_TA2CCR1:
+        if (runSampler(0, &TA2CCR1)) {
+            __bic_SR_register_on_exit(LPM3_bits);
+        }
+        break;
+    case TA2IV_TA2CCR2:
+        if (runSampler(1, &TA2CCR2)) {
+            __bic_SR_register_on_exit(LPM3_bits);
+        }
+        break;
+    case TA2IV_TA2IFG:
+        timeHigh++;
+        if (wakeArmed && armCompare()) {
+            TA2CCTL0 = 0;
+            __bic_SR_register_on_exit(LPM3_bits);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+// SOFTWARE TIMER WHEEL
+// Each timer is kept in the slot its expiry time falls in. timerPoll only
+// visits the slots the time has moved through since the previous poll, and
+// timerNextWake stops at the first slot that starts after its limit. Timers
+// further away than one turn of the wheel simply stay in their slot until
+// their turn comes.
+#define TIMER_SLOT_TICKS    (1UL << TIMER_SLOT_SHIFT)
+#define slotOf(t)           ((unsigned int)((t) >> TIMER_SLOT_SHIFT) & (TIMER_WHEEL_SLOTS - 1))
+
+static SoftTimer *timerWheel[TIMER_WHEEL_SLOTS];
+static unsigned long lastPoll = 0;
+
+// Adds a timer to the slot of its expiry time
+static void wheelInsert(SoftTimer *timer)
+{
+    unsigned int slot = slotOf(timer->expires);
+
+    timer->next = timerWheel[slot];
+    timerWheel[slot] = timer;
+    timer->active = true;
+}
+
+// Takes a timer out of its slot
+static void wheelRemove(SoftTimer *timer)
+{
+    SoftTimer **link = &timerWheel[slotOf(timer->expires)];
+
+    while (*link) {
+        if (*link == timer) {
+            *link = timer->next;
+            break;
+        }
+        link = &(*link)->next;
+    }
+    timer->active = false;
+}
+
+// Starts a timer which fires after delay ticks and then every period ticks,
+// or only once if period is 0. Restarts the timer if it is already running.
+void timerSet(SoftTimer *timer, unsigned long delay, unsigned long period,
+              void (*callback)(SoftTimer *timer))
+{
+    timerSetAt(timer, timeNow() + delay, period, callback);
+}
+
+// Starts a timer which fires at time expires and then every period ticks, or
+// only once if period is 0. Restarts the timer if it is already running. A
+// time already passed before the previous poll is moved up to it, since the
+// poll does not look back further, so the timer fires at the next poll.
+void timerSetAt(SoftTimer *timer, unsigned long expires, unsigned long period,
+                void (*callback)(SoftTimer *timer))
+{
+    if (timer->active) {
+        wheelRemove(timer);
+    }
+
+    timer->expires = timeReached(expires, lastPoll) ? expires : lastPoll;
+    timer->period = period;
+    timer->callback = callback;
+    timer->fired = false;
+    wheelInsert(timer);
+}
+
+// Stops a timer without firing it
+void timerCancel(SoftTimer *timer)
+{
+    if (timer->active) {
+        wheelRemove(timer);
+    }
+}
+
+// Returns true while a timer is waiting to fire
+bool timerIsActive(const SoftTimer *timer)
+{
+    return timer->active;
+}
+
+// Returns true once for each time a timer has fired
+bool timerFired(SoftTimer *timer)
+{
+    if (timer->fired) {
+        timer->fired = false;
+        return true;
+    }
+    return false;
+}
+
+// Takes a timer out of the wheel and fires it. A periodic timer is put back
+// for its next period; periods missed while the CPU was busy are skipped.
+static void timerFire(SoftTimer *timer, unsigned long now)
+{
+    wheelRemove(timer);
+    timer->fired = true;
+
+    if (timer->period) {
+        do {
+            timer->expires += timer->period;
+        } while (timeReached(now, timer->expires));
+        wheelInsert(timer);
+    }
+
+    if (timer->callback) {
+        timer->callback(timer);
+    }
+}
+
+// Fires every timer whose expiry time has been reached
+void timerPoll(void)
+{
+    unsigned long now = timeNow();
+    unsigned long slotTime = lastPoll & ~(TIMER_SLOT_TICKS - 1);
+    unsigned int count = 0;
+    SoftTimer *timer;
+
+    do {
+        timer = timerWheel[slotOf(slotTime)];
+        while (timer) {
+            if (timeReached(now, timer->expires)) {
+                timerFire(timer, now);
+
+                // the callback may have set or cancelled any timer, so walk
+                // this slot again from the start
+                timer = timerWheel[slotOf(slotTime)];
+            }
+            else {
+                timer = timer->next;
+            }
+        }
+        slotTime += TIMER_SLOT_TICKS;
+    } while (++count < TIMER_WHEEL_SLOTS && timeReached(now, slotTime));
+
+    lastPoll = now;
+}
+
+// Returns the earliest expiry time of all timers, or limit if that is sooner.
+// The walk starts at the slot of the previous poll, so timers which are
+// already due but not fired yet are found too.
+unsigned long timerNextWake(unsigned long limit)
+{
+    unsigned long slotTime = lastPoll & ~(TIMER_SLOT_TICKS - 1);
+    unsigned int count;
+    SoftTimer *timer;
+
+    for (count = 0; count < TIMER_WHEEL_SLOTS && !timeReached(slotTime, limit); count++) {
+        for (timer = timerWheel[slotOf(slotTime)]; timer; timer = timer->next) {
+            if (!timeReached(timer->expires, limit)) {
+                limit = timer->expires;
+            }
+        }
+        slotTime += TIMER_SLOT_TICKS;
+    }
+
+    return limit;
+}
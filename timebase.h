@@ -0,0 +1,94 @@
+/*
+ * timebase.h
+ *
+ * Tickless time service on Timer A2.
+ *
+ * TA2 counts ACLK (32768 Hz) continuously. Its overflow interrupt (every
+ * 2 seconds) extends the count to 32 bits, and CCR0 only interrupts when the
+ * next wake up time is due, so the CPU can stay in LPM3 between events
+ * instead of waking up for a 1 kHz tick.
+ */
+
+#ifndef TIMEBASE_H_
+#define TIMEBASE_H_
+
+#include <msp430.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Counter frequency in Hz (ACLK)
+#define TIME_TICKS_PER_SECOND   32768UL
+
+// Returns true once time a is at or after time b, correct across wrap around
+#define timeReached(a, b)       ((long)((a) - (b)) >= 0)
+
+// UNIT CONVERSION
+// One tick is 1000000 / 32768 = 15625 / 512 us, or 125 / 4096 ms, so the
+// conversions are exact in fixed point without any rounding drift. Times
+// converted to ticks are rounded up, so a delay is never shorter than asked
+// for; ticks converted to us or ms are rounded down.
+// For constants, the conversion is done by the compiler (ms up to 1048575)
+#define TIME_MS_TO_TICKS(ms)    (((unsigned long)(ms) * 4096UL + 124) / 125)
+
+// SAMPLERS
+// Periodic functions called straight from the TA2 CCR1 and CCR2 interrupts,
+// for input sampling which has to keep running while the CPU sleeps in LPM3.
+// A sampler is told the exact time its sample was due at, and returns true
+// to wake the main loop.
+#define TIME_SAMPLERS           2
+
+typedef bool (*TimeSampler)(unsigned long sampleTime);
+
+// SMCLK USERS
+// LPM3 stops SMCLK. Modules clocked from it register a function returning
+// true while they need it, and timeSleepUntil() only goes down to LPM0 while
+// any of them does. The functions are called with interrupts disabled.
+#define TIME_SMCLK_USERS        4
+
+typedef bool (*TimeSmclkUser)(void);
+
+// SOFTWARE TIMERS
+// Any number of one-shot or periodic timers, kept in a timer wheel. A timer
+// fires once timerPoll() finds its expiry time reached: fired is set and the
+// callback, if any, is called from timerPoll(). Timers are only used from the
+// main loop, never from interrupt service routines.
+typedef struct SoftTimer {
+    struct SoftTimer *next;     // next timer in the same wheel slot
+    unsigned long expires;      // time the timer fires at, in ACLK ticks
+    unsigned long period;       // time between firings, 0 for a one-shot timer
+    void (*callback)(struct SoftTimer *timer);
+    bool active;                // waiting in the wheel
+    bool fired;                 // fired since the last timerFired() call
+} SoftTimer;
+
+// Timer wheel size: TIMER_WHEEL_SLOTS slots of 2^TIMER_SLOT_SHIFT ticks each
+#define TIMER_SLOT_SHIFT        10
+#define TIMER_WHEEL_SLOTS       16
+
+// Prototypes for functions implemented in timebase.c
+void timeInit(void);
+unsigned long timeNow(void);
+unsigned long timeMicros(void);
+unsigned long timeMillis(void);
+unsigned long timeTicksToUs(unsigned long ticks);
+unsigned long timeTicksToMs(unsigned long ticks);
+unsigned long timeUsToTicks(unsigned long us);
+unsigned long timeMsToTicks(unsigned long ms);
+void timeSleepUntil(unsigned long wakeTime);
+unsigned int timeAwakePercent(void);
+void timeSamplerStart(uint8_t channel, unsigned int period, TimeSampler sampler);
+void timeSamplerSetPeriod(uint8_t channel, unsigned int period);
+void timeSamplerStop(uint8_t channel);
+void timeSmclkUser(TimeSmclkUser needsSmclk);
+
+void timerSet(SoftTimer *timer, unsigned long delay, unsigned long period,
+              void (*callback)(SoftTimer *timer));
+void timerSetAt(SoftTimer *timer, unsigned long expires, unsigned long period,
+                void (*callback)(SoftTimer *timer));
+void timerCancel(SoftTimer *timer);
+bool timerIsActive(const SoftTimer *timer);
+bool timerFired(SoftTimer *timer);
+void timerPoll(void);
+unsigned long timerNextWake(unsigned long limit);
+
+#endif /* TIMEBASE_H_ */
@@ -0,0 +1,147 @@
+/*
+ * wavetable.c
+ *
+ * Wavetables and note phase increments for the audio engine, see wavetable.h.
+ */
+
+#include "wavetable.h"
+
+// One period of a sine wave
+const int8_t waveSine[WAVE_LENGTH] = {
+       0,    3,    6,    9,   12,   16,   19,   22,   25,   28,   31,   34,   37,   40,   43,   46,
+      49,   51,   54,   57,   60,   63,   65,   68,   71,   73,   76,   78,   81,   83,   85,   88,
+      90,   92,   94,   96,   98,  100,  102,  104,  106,  107,  109,  111,  112,  113,  115,  116,
+     117,  118,  120,  121,  122,  122,  123,  124,  125,  125,  126,  126,  126,  127,  127,  127,
+     127,  127,  127,  127,  126,  126,  126,  125,  125,  124,  123,  122,  122,  121,  120,  118,
+     117,  116,  115,  113,  112,  111,  109,  107,  106,  104,  102,  100,   98,   96,   94,   92,
+      90,   88,   85,   83,   81,   78,   76,   73,   71,   68,   65,   63,   60,   57,   54,   51,
+      49,   46,   43,   40,   37,   34,   31,   28,   25,   22,   19,   16,   12,    9,    6,    3,
+       0,   -3,   -6,   -9,  -12,  -16,  -19,  -22,  -25,  -28,  -31,  -34,  -37,  -40,  -43,  -46,
+     -49,  -51,  -54,  -57,  -60,  -63,  -65,  -68,  -71,  -73,  -76,  -78,  -81,  -83,  -85,  -88,
+     -90,  -92,  -94,  -96,  -98, -100, -102, -104, -106, -107, -109, -111, -112, -113, -115, -116,
+    -117, -118, -120, -121, -122, -122, -123, -124, -125, -125, -126, -126, -126, -127, -127, -127,
+    -127, -127, -127, -127, -126, -126, -126, -125, -125, -124, -123, -122, -122, -121, -120, -118,
+    -117, -116, -115, -113, -112, -111, -109, -107, -106, -104, -102, -100,  -98,  -96,  -94,  -92,
+     -90,  -88,  -85,  -83,  -81,  -78,  -76,  -73,  -71,  -68,  -65,  -63,  -60,  -57,  -54,  -51,
+     -49,  -46,  -43,  -40,  -37,  -34,  -31,  -28,  -25,  -22,  -19,  -16,  -12,   -9,   -6,   -3
+};
+
+// One period of an organ like tone: the fundamental with its 2nd and 3rd
+// harmonics at 1/2 and 1/3 of its amplitude
+const int8_t waveOrgan[WAVE_LENGTH] = {
+       0,    6,   13,   19,   26,   32,   38,   44,   50,   56,   62,   67,   73,   78,   83,   87,
+      92,   96,  100,  104,  107,  110,  113,  116,  118,  120,  122,  124,  125,  126,  126,  127,
+     127,  127,  126,  126,  125,  124,  123,  121,  120,  118,  116,  114,  111,  109,  106,  104,
+     101,   98,   96,   93,   90,   87,   84,   82,   79,   76,   73,   71,   68,   66,   63,   61,
+      59,   57,   55,   53,   51,   49,   48,   46,   45,   44,   43,   42,   41,   40,   40,   39,
+      39,   39,   38,   38,   38,   38,   38,   38,   38,   38,   38,   39,   39,   39,   39,   39,
+      39,   39,   39,   39,   39,   38,   38,   38,   37,   36,   36,   35,   34,   33,   32,   31,
+      30,   28,   27,   25,   24,   22,   20,   19,   17,   15,   13,   11,    9,    6,    4,    2,
+       0,   -2,   -4,   -6,   -9,  -11,  -13,  -15,  -17,  -19,  -20,  -22,  -24,  -25,  -27,  -28,
+     -30,  -31,  -32,  -33,  -34,  -35,  -36,  -36,  -37,  -38,  -38,  -38,  -39,  -39,  -39,  -39,
+     -39,  -39,  -39,  -39,  -39,  -39,  -38,  -38,  -38,  -38,  -38,  -38,  -38,  -38,  -38,  -39,
+     -39,  -39,  -40,  -40,  -41,  -42,  -43,  -44,  -45,  -46,  -48,  -49,  -51,  -53,  -55,  -57,
+     -59,  -61,  -63,  -66,  -68,  -71,  -73,  -76,  -79,  -82,  -84,  -87,  -90,  -93,  -96,  -98,
+    -101, -104, -106, -109, -111, -114, -116, -118, -120, -121, -123, -124, -125, -126, -126, -127,
+    -127, -127, -126, -126, -125, -124, -122, -120, -118, -116, -113, -110, -107, -104, -100,  -96,
+     -92,  -87,  -83,  -78,  -73,  -67,  -62,  -56,  -50,  -44,  -38,  -32,  -26,  -19,  -13,   -6
+};
+
+// One period of a reed like tone: the fundamental with its 3rd harmonic at
+// 1/3 of its amplitude, the start of a square wave's series
+const int8_t waveReed[WAVE_LENGTH] = {
+       0,    7,   13,   20,   26,   33,   39,   45,   51,   57,   63,   68,   74,   79,   84,   89,
+      93,   97,  101,  105,  108,  111,  114,  117,  119,  121,  123,  124,  125,  126,  127,  127,
+     127,  127,  127,  126,  125,  124,  123,  122,  121,  119,  118,  116,  114,  113,  111,  109,
+     107,  105,  104,  102,  100,   99,   97,   96,   95,   94,   93,   92,   91,   91,   90,   90,
+      90,   90,   90,   91,   91,   92,   93,   94,   95,   96,   97,   99,  100,  102,  104,  105,
+     107,  109,  111,  113,  114,  116,  118,  119,  121,  122,  123,  124,  125,  126,  127,  127,
+     127,  127,  127,  126,  125,  124,  123,  121,  119,  117,  114,  111,  108,  105,  101,   97,
+      93,   89,   84,   79,   74,   68,   63,   57,   51,   45,   39,   33,   26,   20,   13,    7,
+       0,   -7,  -13,  -20,  -26,  -33,  -39,  -45,  -51,  -57,  -63,  -68,  -74,  -79,  -84,  -89,
+     -93,  -97, -101, -105, -108, -111, -114, -117, -119, -121, -123, -124, -125, -126, -127, -127,
+    -127, -127, -127, -126, -125, -124, -123, -122, -121, -119, -118, -116, -114, -113, -111, -109,
+    -107, -105, -104, -102, -100,  -99,  -97,  -96,  -95,  -94,  -93,  -92,  -91,  -91,  -90,  -90,
+     -90,  -90,  -90,  -91,  -91,  -92,  -93,  -94,  -95,  -96,  -97,  -99, -100, -102, -104, -105,
+    -107, -109, -111, -113, -114, -116, -118, -119, -121, -122, -123, -124, -125, -126, -127, -127,
+    -127, -127, -127, -126, -125, -124, -123, -121, -119, -117, -114, -111, -108, -105, -101,  -97,
+     -93,  -89,  -84,  -79,  -74,  -68,  -63,  -57,  -51,  -45,  -39,  -33,  -26,  -20,  -13,   -7
+};
+
+// Phase increment of each note at WAVE_SAMPLE_RATE (8192 Hz): the note
+// frequency times 2^32 / 8192, rounded
+const uint32_t wavePhaseIncrements[WAVE_NOTE_COUNT] = {
+      17145893UL,  // C1     32.703 Hz
+      18165441UL,  // C#1    34.648 Hz
+      19245614UL,  // D1     36.708 Hz
+      20390018UL,  // D#1    38.891 Hz
+      21602472UL,  // E1     41.203 Hz
+      22887021UL,  // F1     43.654 Hz
+      24247954UL,  // F#1    46.249 Hz
+      25689813UL,  // G1     48.999 Hz
+      27217409UL,  // G#1    51.913 Hz
+      28835840UL,  // A1     55.000 Hz
+      30550508UL,  // A#1    58.270 Hz
+      32367136UL,  // B1     61.735 Hz
+      34291786UL,  // C2     65.406 Hz
+      36330882UL,  // C#2    69.296 Hz
+      38491228UL,  // D2     73.416 Hz
+      40780036UL,  // D#2    77.782 Hz
+      43204943UL,  // E2     82.407 Hz
+      45774043UL,  // F2     87.307 Hz
+      48495909UL,  // F#2    92.499 Hz
+      51379626UL,  // G2     97.999 Hz
+      54434817UL,  // G#2   103.826 Hz
+      57671680UL,  // A2    110.000 Hz
+      61101017UL,  // A#2   116.541 Hz
+      64734272UL,  // B2    123.471 Hz
+      68583572UL,  // C3    130.813 Hz
+      72661764UL,  // C#3   138.591 Hz
+      76982457UL,  // D3    146.832 Hz
+      81560072UL,  // D#3   155.563 Hz
+      86409886UL,  // E3    164.814 Hz
+      91548086UL,  // F3    174.614 Hz
+      96991818UL,  // F#3   184.997 Hz
+     102759252UL,  // G3    195.998 Hz
+     108869635UL,  // G#3   207.652 Hz
+     115343360UL,  // A3    220.000 Hz
+     122202033UL,  // A#3   233.082 Hz
+     129468544UL,  // B3    246.942 Hz
+     137167144UL,  // C4    261.626 Hz
+     145323527UL,  // C#4   277.183 Hz
+     153964914UL,  // D4    293.665 Hz
+     163120144UL,  // D#4   311.127 Hz
+     172819773UL,  // E4    329.628 Hz
+     183096171UL,  // F4    349.228 Hz
+     193983636UL,  // F#4   369.994 Hz
+     205518503UL,  // G4    391.995 Hz
+     217739269UL,  // G#4   415.305 Hz
+     230686720UL,  // A4    440.000 Hz
+     244404066UL,  // A#4   466.164 Hz
+     258937088UL,  // B4    493.883 Hz
+     274334289UL,  // C5    523.251 Hz
+     290647054UL,  // C#5   554.365 Hz
+     307929828UL,  // D5    587.330 Hz
+     326240288UL,  // D#5   622.254 Hz
+     345639545UL,  // E5    659.255 Hz
+     366192342UL,  // F5    698.456 Hz
+     387967272UL,  // F#5   739.989 Hz
+     411037006UL,  // G5    783.991 Hz
+     435478539UL,  // G#5   830.609 Hz
+     461373440UL,  // A5    880.000 Hz
+     488808132UL,  // A#5   932.328 Hz
+     517874176UL,  // B5    987.767 Hz
+     548668578UL,  // C6   1046.502 Hz
+     581294109UL,  // C#6  1108.731 Hz
+     615859655UL,  // D6   1174.659 Hz
+     652480576UL,  // D#6  1244.508 Hz
+     691279090UL,  // E6   1318.510 Hz
+     732384684UL,  // F6   1396.913 Hz
+     775934544UL,  // F#6  1479.978 Hz
+     822074013UL,  // G6   1567.982 Hz
+     870957077UL,  // G#6  1661.219 Hz
+     922746880UL,  // A6   1760.000 Hz
+     977616265UL,  // A#6  1864.655 Hz
+    1035748353UL,  // B6   1975.533 Hz
+    1097337155UL   // C7   2093.005 Hz
+};
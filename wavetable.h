@@ -0,0 +1,41 @@
+/*
+ * wavetable.h
+ *
+ * Wavetables and note phase increments for the audio engine.
+ *
+ * A wavetable is one period of a tone, 256 signed 8 bit samples starting at
+ * a rising zero crossing, kept in flash. The tones are built from only their
+ * first three harmonics, so every harmonic of notes up to E6 (1319 Hz) stays
+ * below half the sample rate and nothing aliases. Higher notes are in the
+ * table for the sine wave.
+ *
+ * The phase increment of a note is its frequency in 2^-32 periods per sample,
+ * worked out ahead of time for WAVE_SAMPLE_RATE. At this size the tuning error
+ * is under 0.0001 cents.
+ */
+
+#ifndef WAVETABLE_H_
+#define WAVETABLE_H_
+
+#include <stdint.h>
+#include "notetable.h"
+
+// Samples per wavetable, a power of 2 indexed by the top bits of the phase
+#define WAVE_LENGTH         256
+#define WAVE_INDEX_SHIFT    24
+
+// Sample rate the phase increments are worked out for, in Hz
+#define WAVE_SAMPLE_RATE    8192UL
+
+// Range of MIDI notes with a phase increment, C1 to C7
+#define WAVE_NOTE_LOWEST    NOTE_LOWEST
+#define WAVE_NOTE_HIGHEST   96
+#define WAVE_NOTE_COUNT     (WAVE_NOTE_HIGHEST - WAVE_NOTE_LOWEST + 1)
+
+extern const int8_t waveSine[WAVE_LENGTH];
+extern const int8_t waveOrgan[WAVE_LENGTH];
+extern const int8_t waveReed[WAVE_LENGTH];
+
+extern const uint32_t wavePhaseIncrements[WAVE_NOTE_COUNT];
+
+#endif /* WAVETABLE_H_ */